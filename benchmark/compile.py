@@ -0,0 +1,235 @@
+#!/usr/bin/env python3
+#
+# Measures the build cost of the template-heavy parts of the core library.
+#
+#   compile.py [--quick] [--timeout SECONDS] [--compiler CXX]... [--output FILE]
+#
+# Generates one source file per case and size, and compiles it with every
+# compiler (g++ and clang++ by default, those that are not found are
+# skipped). The cases are:
+#
+#   members      An introspected class with SIZE members, lowered as the
+#                parser lowers it (see test/parsed.h), that is counted,
+#                constructed, copied and destructed through the factory.
+#   initializer  An introspected class with SIZE members, initialized by
+#                __ngc_initialize__ with an initialization list that names
+#                each of them (i.e., SIZE names and SIZE values).
+#   pack         An __ngc_parameter_pack__ of SIZE types, reversed, and an
+#                __ngc_index_pack__ of SIZE indexes.
+#   arrays       A point nested in SIZE levels of arrays of 2, constructed
+#                and destructed.
+#
+# For each compilation, the results list the wall time (wall_s), the peak
+# resident set of the compiler (rss_kb), the number of template
+# instantiations (instantiations), the size of the object file (object_bytes)
+# and whether the compilation succeeded. Clang counts the instantiations in
+# its -ftime-trace output. GCC has no equivalent, so its count is the number
+# of template specializations among the symbols of the object, which misses
+# the class templates that emit no code. A compilation that takes more than
+# SECONDS (300 by default) is killed, and recorded as failed with a "timeout"
+# error. The results are written as JSON, to the standard output or to FILE.
+# --quick only compiles the smallest sizes, to check that the harness works.
+
+import argparse
+import json
+import os
+import shutil
+import signal
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SIZES = {
+    'members': [10, 100, 500, 1000, 2000],
+    'initializer': [1, 10, 100, 500],
+    'pack': [1, 10, 100, 500, 1000, 2000],
+    'arrays': [1, 2, 4, 6, 8],
+}
+
+QUICK = {
+    'members': [10],
+    'initializer': [10],
+    'pack': [10],
+    'arrays': [2],
+}
+
+FLAGS = ['-std=c++17', '-O0', '-c']
+
+TIMEOUT = 300
+
+
+def name(prefix, index):
+    text = prefix + str(index)
+    return ', '.join("'" + char + "'" for char in text)
+
+
+def wide(size):
+    lines = ['#include "parsed.h"', '', 'class wide', '{', 'public:', '',
+             '  typedef wide __ngc_introspected__;',
+             '  template <size_t, bool> struct __ngc_member__;', '',
+             '  inline void __ngc_destruct__()', '  {', '  }', '']
+
+    for index in range(size):
+        lines.append('  int m%d;' % index)
+        lines.append('  NGC_PARSED_MEMBER(wide, %d, int, m%d, %s)' % (index, index, name('m', index)))
+
+    return lines + ['};', '',
+                    'static_assert(__ngc_member_count__ <wide> :: value == %d, "");' % size, '']
+
+
+def members(size):
+    lines = wide(size)
+    lines += ['void run(wide & that, const wide & other)', '{',
+              '  __ngc_construct__(that, other);',
+              '  __ngc_destruct__(that);',
+              '  __ngc_construct__(that);',
+              '}']
+
+    return lines
+
+
+def initializer(size):
+    arguments = ', '.join('ngc :: string <%s> {}, %d' % (name('m', index), index) for index in range(size))
+
+    return wide(size) + ['void run(wide & that)', '{',
+                         '  __ngc_initialize__(that, %s);' % arguments,
+                         '}']
+
+
+def pack(size):
+    return ['#include "parsed.h"', '',
+            'template <size_t> struct slot;', '',
+            'typedef __ngc_parameter_pack__ <%s> forward;' % ', '.join('slot <%d>' % index for index in range(size)),
+            'typedef __ngc_reverse_parameter_pack__ <forward> :: type backward;',
+            'typedef __ngc_make_index_pack__ <%d> :: type indexes;' % size, '',
+            'backward * run(indexes)', '{',
+            '  return nullptr;',
+            '}']
+
+
+def arrays(size):
+    return ['#include "parsed.h"', '',
+            'void run(point (& that)%s)' % ('[2]' * size), '{',
+            '  __ngc_construct__(that);',
+            '  __ngc_destruct__(that);',
+            '}']
+
+
+CASES = {'members': members, 'initializer': initializer, 'pack': pack, 'arrays': arrays}
+
+
+def instantiations(compiler, directory, path):
+    if 'clang' in os.path.basename(compiler):
+        trace = os.path.splitext(path)[0] + '.json'
+
+        if not os.path.exists(trace):
+            return None
+
+        with open(trace) as file:
+            events = json.load(file)['traceEvents']
+
+        return sum(1 for event in events if event.get('name') in ('InstantiateClass', 'InstantiateFunction'))
+
+    nm = shutil.which('nm')
+
+    if nm is None:
+        return None
+
+    output = subprocess.run([nm, '-C', '--defined-only', path], capture_output=True, text=True, cwd=directory).stdout
+    return sum(1 for line in output.splitlines() if '<' in line)
+
+
+def compile(compiler, directory, case, size, timeout):
+    source = os.path.join(directory, '%s_%d.cpp' % (case, size))
+    target = os.path.join(directory, '%s_%d.o' % (case, size))
+
+    with open(source, 'w') as file:
+        file.write('\n'.join(CASES[case](size)) + '\n')
+
+    command = [compiler] + FLAGS + ['-I', os.path.join(ROOT, 'lib'), '-I', os.path.join(ROOT, 'test'), source, '-o', target]
+
+    if 'clang' in os.path.basename(compiler):
+        command.append('-ftime-trace')
+
+    # The compiler runs in its own process group, so that a timeout also
+    # kills the processes it spawned (e.g., cc1plus).
+
+    expired = threading.Event()
+
+    def expire():
+        expired.set()
+        os.killpg(process.pid, signal.SIGKILL)
+
+    with open(target + '.log', 'w') as log:
+        begin = time.monotonic()
+        process = subprocess.Popen(command, stdout=subprocess.DEVNULL, stderr=log, start_new_session=True)
+        timer = threading.Timer(timeout, expire)
+        timer.start()
+        _, status, usage = os.wait4(process.pid, 0)
+        timer.cancel()
+        wall = time.monotonic() - begin
+
+    code = os.waitstatus_to_exitcode(status)
+    result = {'compiler': compiler, 'case': case, 'size': size, 'wall_s': round(wall, 3), 'rss_kb': usage.ru_maxrss, 'ok': code == 0 and not expired.is_set()}
+
+    if expired.is_set():
+        result['error'] = 'timeout'
+    elif code == 0:
+        result['instantiations'] = instantiations(compiler, directory, target)
+        result['object_bytes'] = os.path.getsize(target)
+    else:
+        with open(target + '.log') as log:
+            errors = [line for line in log.read().splitlines() if 'error' in line]
+
+        result['error'] = errors[0] if errors else 'exit status %d' % code
+
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Measures the build cost of the core library.')
+    parser.add_argument('--quick', action='store_true')
+    parser.add_argument('--timeout', type=float, default=TIMEOUT)
+    parser.add_argument('--compiler', action='append')
+    parser.add_argument('--output')
+    arguments = parser.parse_args()
+
+    sizes = QUICK if arguments.quick else SIZES
+    compilers = [compiler for compiler in (arguments.compiler or ['g++', 'clang++']) if shutil.which(compiler)]
+
+    if not compilers:
+        print('No compiler found.', file=sys.stderr)
+        return 1
+
+    results = []
+
+    with tempfile.TemporaryDirectory() as directory:
+        for compiler in compilers:
+            for case in CASES:
+                for size in sizes[case]:
+                    results.append(compile(compiler, directory, case, size, arguments.timeout))
+
+    text = json.dumps({'flags': ' '.join(FLAGS), 'results': results}, indent=2) + '\n'
+
+    if arguments.output:
+        with open(arguments.output, 'w') as file:
+            file.write(text)
+    else:
+        sys.stdout.write(text)
+
+    # A case that does not compile (or times out) is a result, e.g., of a
+    # size beyond the compiler's limits, except in quick mode, where every
+    # case must compile.
+
+    if arguments.quick and not all(result['ok'] for result in results):
+        return 1
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
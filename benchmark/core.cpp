@@ -0,0 +1,312 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file core.cpp
+
+  This file includes the runtime benchmarks of the core library. Each
+  benchmark runs the same operation on a batch of objects twice: through the
+  core library (e.g., \c __ngc_optional__, \c __ngc_initialize__,
+  \c __ngc_destruct__), and through its standard or hand-written equivalent
+  (e.g., \c std \c :: \c optional, a member initialization list, an implicit
+  destructor). The results are written as JSON, to the standard output or to
+  the file that follows \c --output, so that they can be tracked over
+  releases. \c --quick runs every benchmark only a few times, to check that
+  the benchmarks build and run.
+
+  \see benchmark/run.sh
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#include <new>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "measure.h"
+#include "../test/parsed.h"
+
+namespace
+{
+  using ngc_benchmark :: escape;
+  using ngc_benchmark :: result;
+
+  constexpr size_t batch = 1024;
+
+  /**
+    \fn measure
+    \brief Runs \c setup, then times \c body, \c rounds times, and returns the
+    best time per operation, in nanoseconds. \c body runs \c batch
+    operations, \c setup is not timed.
+  */
+  template <typename stype, typename btype> double measure(size_t rounds, stype && setup, btype && body)
+  {
+    return ngc_benchmark :: best(rounds, setup, body) / batch;
+  }
+
+  template <typename btype> double measure(size_t rounds, btype && body)
+  {
+    return measure(rounds, [](){}, body);
+  }
+
+  inline point make_point(size_t i)
+  {
+    point that;
+
+    that.x = (double) i;
+    that.y = (double) i * 2;
+    that.z = (double) i * 3;
+    that.tag = (int) i;
+
+    return that;
+  }
+
+  // Optionals
+
+  result optional_construct(size_t rounds)
+  {
+    double ngc = measure(rounds, []()
+    {
+      for(size_t i = 0; i < batch; i++)
+      {
+        __ngc_optional__ <point> that(make_point(i));
+        escape(that);
+      }
+    });
+
+    double baseline = measure(rounds, []()
+    {
+      for(size_t i = 0; i < batch; i++)
+      {
+        std :: optional <point> that(make_point(i));
+        escape(that);
+      }
+    });
+
+    return {"optional_construct", ngc, baseline};
+  }
+
+  result optional_reset(size_t rounds)
+  {
+    static __ngc_optional__ <point> ngc_optionals[batch];
+    static std :: optional <point> std_optionals[batch];
+
+    double ngc = measure(rounds, []()
+    {
+      for(size_t i = 0; i < batch; i++)
+        ngc_optionals[i](make_point(i));
+    }, []()
+    {
+      for(size_t i = 0; i < batch; i++)
+        ngc_optionals[i].__ngc_delete__();
+
+      escape(ngc_optionals);
+    });
+
+    double baseline = measure(rounds, []()
+    {
+      for(size_t i = 0; i < batch; i++)
+        std_optionals[i].emplace(make_point(i));
+    }, []()
+    {
+      for(size_t i = 0; i < batch; i++)
+        std_optionals[i].reset();
+
+      escape(std_optionals);
+    });
+
+    return {"optional_reset", ngc, baseline};
+  }
+
+  result optional_copy(size_t rounds)
+  {
+    static __ngc_optional__ <point> ngc_optionals[batch];
+    static std :: optional <point> std_optionals[batch];
+
+    for(size_t i = 0; i < batch; i += 2)
+    {
+      ngc_optionals[i](make_point(i));
+      std_optionals[i].emplace(make_point(i));
+    }
+
+    double ngc = measure(rounds, []()
+    {
+      for(size_t i = 0; i < batch; i++)
+      {
+        __ngc_optional__ <point> that(ngc_optionals[i]);
+        escape(that);
+      }
+    });
+
+    double baseline = measure(rounds, []()
+    {
+      for(size_t i = 0; i < batch; i++)
+      {
+        std :: optional <point> that(std_optionals[i]);
+        escape(that);
+      }
+    });
+
+    return {"optional_copy", ngc, baseline};
+  }
+
+  result optional_check(size_t rounds)
+  {
+    static __ngc_optional__ <point> ngc_optionals[batch];
+    static std :: optional <point> std_optionals[batch];
+
+    for(size_t i = 0; i < batch; i += 3)
+    {
+      ngc_optionals[i](make_point(i));
+      std_optionals[i].emplace(make_point(i));
+    }
+
+    double ngc = measure(rounds, []()
+    {
+      double sum = 0;
+
+      for(size_t i = 0; i < batch; i++)
+        if(ngc_optionals[i].__ngc_exists__)
+          sum += __ngc_unwrap__(ngc_optionals[i]).x;
+
+      escape(sum);
+    });
+
+    double baseline = measure(rounds, []()
+    {
+      double sum = 0;
+
+      for(size_t i = 0; i < batch; i++)
+        if(std_optionals[i].has_value())
+          sum += std_optionals[i]->x;
+
+      escape(sum);
+    });
+
+    return {"optional_check", ngc, baseline};
+  }
+
+  // Factory
+
+  result initialize(size_t rounds)
+  {
+    static storage <point> ngc_points[batch];
+    static storage <native_point> native_points[batch];
+
+    double ngc = measure(rounds, []()
+    {
+      for(size_t i = 0; i < batch; i++)
+        __ngc_initialize__(ngc_points[i].get(), ngc :: string <'x'> {}, (double) i, ngc :: string <'y'> {}, (double) i * 2, ngc :: string <'z'> {}, (double) i * 3, ngc :: string <'t', 'a', 'g'> {}, (int) i);
+
+      escape(ngc_points);
+    });
+
+    double baseline = measure(rounds, []()
+    {
+      for(size_t i = 0; i < batch; i++)
+        new (&native_points[i].get()) native_point((double) i, (double) i * 2, (double) i * 3, (int) i);
+
+      escape(native_points);
+    });
+
+    return {"initialize", ngc, baseline};
+  }
+
+  result destruct(size_t rounds)
+  {
+    static storage <sample> ngc_samples[batch];
+    static storage <native_sample> native_samples[batch];
+
+    static const sample ngc_source = {1700000000123, 42, 21.5, "a label longer than the small buffer"};
+    static const native_sample native_source = {1700000000123, 42, 21.5, "a label longer than the small buffer"};
+
+    double ngc = measure(rounds, []()
+    {
+      for(size_t i = 0; i < batch; i++)
+        __ngc_construct__(ngc_samples[i].get(), ngc_source);
+    }, []()
+    {
+      for(size_t i = 0; i < batch; i++)
+        __ngc_destruct__(ngc_samples[i].get());
+
+      escape(ngc_samples);
+    });
+
+    double baseline = measure(rounds, []()
+    {
+      for(size_t i = 0; i < batch; i++)
+        new (&native_samples[i].get()) native_sample(native_source);
+    }, []()
+    {
+      for(size_t i = 0; i < batch; i++)
+        native_samples[i].get().~native_sample();
+
+      escape(native_samples);
+    });
+
+    return {"destruct", ngc, baseline};
+  }
+
+  // Introspection
+
+  result member_get(size_t rounds)
+  {
+    // Both sides read the same array: only the access differs.
+
+    static point points[batch];
+
+    for(size_t i = 0; i < batch; i++)
+      points[i] = make_point(i);
+
+    double ngc = measure(rounds, []()
+    {
+      double sum = 0;
+
+      for(size_t i = 0; i < batch; i++)
+        sum += point :: __ngc_member__ <0, false> :: get(points[i]) * points[i][ngc :: string <'y'> {}] + points[i][ngc :: string <'z'> {}];
+
+      escape(sum);
+    });
+
+    double baseline = measure(rounds, []()
+    {
+      double sum = 0;
+
+      for(size_t i = 0; i < batch; i++)
+        sum += points[i].x * points[i].y + points[i].z;
+
+      escape(sum);
+    });
+
+    return {"member_get", ngc, baseline};
+  }
+};
+
+int main(int argc, char ** argv)
+{
+  return ngc_benchmark :: run(argc, argv, [](bool quick)
+  {
+    size_t rounds = quick ? 3 : 2000;
+
+    return std :: vector <result>
+    {
+      optional_construct(rounds),
+      optional_reset(rounds),
+      optional_copy(rounds),
+      optional_check(rounds),
+      initialize(rounds),
+      destruct(rounds),
+      member_get(rounds)
+    };
+  });
+}
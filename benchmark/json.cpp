@@ -0,0 +1,378 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file json.cpp
+
+  This file includes the runtime benchmarks of \c ngc \c :: \c to_json,
+  against a hand-written writer that appends the same literal keys and uses
+  the same \c std \c :: \c to_chars calls, and of \c ngc \c :: \c from_json,
+  against parsing each document into a DOM (a tree of \c node objects, as
+  most JSON libraries build), then copying the values out of the DOM into
+  the object. Records are \c sample objects, with a 38 characters label.
+  Times are per byte of JSON, i.e., a time of \c t nanoseconds is a
+  throughput of \c 1 \c / \c t GB/s.
+
+  \see reference/json/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 18, 2026
+*/
+
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "measure.h"
+#include "../test/parsed.h"
+#include "ngc/json.h"
+
+namespace
+{
+  using ngc_benchmark :: best;
+  using ngc_benchmark :: escape;
+  using ngc_benchmark :: result;
+
+  std :: vector <sample> make_samples(size_t size)
+  {
+    std :: vector <sample> samples(size);
+
+    for(size_t i = 0; i < size; i++)
+    {
+      samples[i].timestamp = 1700000000000 + i * 37;
+      samples[i].sensor = (int) (i % 4096);
+      samples[i].value = 20 + (i % 1000) * 0.125;
+      samples[i].label = "sensor \"" + std :: to_string(i % 100000) + "\" at the north gate, level 2";
+      samples[i].label.resize(38, '.');
+    }
+
+    return samples;
+  }
+
+  // Hand-written writer
+
+  template <typename type> inline void number(std :: string & buffer, type value)
+  {
+    char digits[32];
+    buffer.append(digits, std :: to_chars(digits, digits + sizeof(digits), value).ptr - digits);
+  }
+
+  inline void string(std :: string & buffer, std :: string_view that)
+  {
+    buffer += '"';
+
+    for(char c : that)
+      if(c == '"' || c == '\\')
+      {
+        buffer += '\\';
+        buffer += c;
+      }
+      else if((unsigned char) c < 0x20)
+      {
+        static const char hex[] = "0123456789abcdef";
+        char escaped[] = {'\\', 'u', '0', '0', hex[(unsigned char) c >> 4], hex[c & 0xf]};
+        buffer.append(escaped, sizeof(escaped));
+      }
+      else
+        buffer += c;
+
+    buffer += '"';
+  }
+
+  inline void write(std :: string & buffer, const sample & that)
+  {
+    buffer.append("{\"timestamp\":", 13);
+    number(buffer, that.timestamp);
+    buffer.append(",\"sensor\":", 10);
+    number(buffer, that.sensor);
+    buffer.append(",\"value\":", 9);
+    number(buffer, that.value);
+    buffer.append(",\"label\":", 9);
+    string(buffer, that.label);
+    buffer += '}';
+  }
+
+  // DOM
+
+  struct node
+  {
+    enum {null, boolean, number, string, array, object} kind = null;
+
+    bool truth = false;
+    double value = 0;
+    std :: string text;
+    std :: vector <node> items;
+    std :: vector <std :: pair <std :: string, node>> fields;
+  };
+
+  struct parser
+  {
+    const char * position;
+    const char * end;
+
+    inline void whitespace()
+    {
+      while(this->position < this->end && (*this->position == ' ' || *this->position == '\n' || *this->position == '\r' || *this->position == '\t'))
+        this->position++;
+    }
+
+    inline bool text(std :: string & target)
+    {
+      if(this->position == this->end || *(this->position++) != '"')
+        return false;
+
+      while(this->position < this->end && *this->position != '"')
+      {
+        char c = *(this->position++);
+
+        if(c != '\\')
+          target += c;
+        else if(this->position == this->end)
+          return false;
+        else
+          switch(char e = *(this->position++))
+          {
+            case 'b': target += '\b'; break;
+            case 'f': target += '\f'; break;
+            case 'n': target += '\n'; break;
+            case 'r': target += '\r'; break;
+            case 't': target += '\t'; break;
+            default: target += e;
+          }
+      }
+
+      return this->position++ < this->end;
+    }
+
+    inline bool parse(node & target)
+    {
+      this->whitespace();
+
+      if(this->position == this->end)
+        return false;
+
+      switch(*this->position)
+      {
+        case '{':
+        {
+          target.kind = node :: object;
+          this->position++;
+          this->whitespace();
+
+          if(this->position < this->end && *this->position == '}')
+            return ++this->position, true;
+
+          while(true)
+          {
+            target.fields.emplace_back();
+            this->whitespace();
+
+            if(!this->text(target.fields.back().first))
+              return false;
+
+            this->whitespace();
+
+            if(this->position == this->end || *(this->position++) != ':' || !this->parse(target.fields.back().second))
+              return false;
+
+            this->whitespace();
+
+            if(this->position == this->end)
+              return false;
+
+            if(*this->position == '}')
+              return ++this->position, true;
+
+            if(*(this->position++) != ',')
+              return false;
+          }
+        }
+        case '[':
+        {
+          target.kind = node :: array;
+          this->position++;
+          this->whitespace();
+
+          if(this->position < this->end && *this->position == ']')
+            return ++this->position, true;
+
+          while(true)
+          {
+            target.items.emplace_back();
+
+            if(!this->parse(target.items.back()))
+              return false;
+
+            this->whitespace();
+
+            if(this->position == this->end)
+              return false;
+
+            if(*this->position == ']')
+              return ++this->position, true;
+
+            if(*(this->position++) != ',')
+              return false;
+          }
+        }
+        case '"':
+          target.kind = node :: string;
+          return this->text(target.text);
+        case 't':
+        case 'f':
+        case 'n':
+        {
+          std :: string_view rest(this->position, this->end - this->position);
+
+          for(std :: string_view word : {std :: string_view("true"), std :: string_view("false"), std :: string_view("null")})
+            if(rest.substr(0, word.size()) == word)
+            {
+              target.kind = word[0] == 'n' ? node :: null : node :: boolean;
+              target.truth = word[0] == 't';
+              this->position += word.size();
+              return true;
+            }
+
+          return false;
+        }
+        default:
+        {
+          target.kind = node :: number;
+          std :: from_chars_result result = std :: from_chars(this->position, this->end, target.value);
+          this->position = result.ptr;
+          return result.ec == std :: errc();
+        }
+      }
+    }
+  };
+
+  // Copies the values of a DOM object into a sample.
+
+  inline bool copy(const node & dom, sample & that)
+  {
+    if(dom.kind != node :: object)
+      return false;
+
+    for(const std :: pair <std :: string, node> & field : dom.fields)
+      if(field.first == "timestamp" && field.second.kind == node :: number)
+        that.timestamp = (long) field.second.value;
+      else if(field.first == "sensor" && field.second.kind == node :: number)
+        that.sensor = (int) field.second.value;
+      else if(field.first == "value" && field.second.kind == node :: number)
+        that.value = field.second.value;
+      else if(field.first == "label" && field.second.kind == node :: string)
+        that.label = field.second.text;
+      else
+        return false;
+
+    return true;
+  }
+
+  // Serialization
+
+  result to_json(size_t rounds, const std :: vector <sample> & source)
+  {
+    std :: string buffer;
+
+    for(const sample & that : source)
+      write(buffer, that);
+
+    size_t bytes = buffer.size();
+
+    double ngc = best(rounds, [&](){ buffer.clear(); }, [&]()
+    {
+      for(const sample & that : source)
+        ngc :: to_json(that, buffer);
+
+      escape(buffer);
+    });
+
+    double baseline = best(rounds, [&](){ buffer.clear(); }, [&]()
+    {
+      for(const sample & that : source)
+        write(buffer, that);
+
+      escape(buffer);
+    });
+
+    return {"to_json_sample", ngc / bytes, baseline / bytes};
+  }
+
+  // Deserialization
+
+  result from_json(size_t rounds, const std :: vector <sample> & source)
+  {
+    std :: string buffer;
+    std :: vector <std :: string_view> documents;
+    std :: vector <size_t> offsets;
+
+    for(const sample & that : source)
+    {
+      offsets.push_back(buffer.size());
+      ngc :: to_json(that, buffer);
+    }
+
+    offsets.push_back(buffer.size());
+
+    for(size_t i = 0; i < source.size(); i++)
+      documents.push_back(std :: string_view(buffer).substr(offsets[i], offsets[i + 1] - offsets[i]));
+
+    std :: vector <sample> targets(source.size());
+
+    double ngc = best(rounds, [](){}, [&]()
+    {
+      bool success = true;
+
+      for(size_t i = 0; i < documents.size(); i++)
+        success &= ngc :: from_json(documents[i], targets[i]);
+
+      escape(success);
+      escape(targets);
+    });
+
+    double baseline = best(rounds, [](){}, [&]()
+    {
+      bool success = true;
+
+      for(size_t i = 0; i < documents.size(); i++)
+      {
+        node dom;
+        parser reader = {documents[i].data(), documents[i].data() + documents[i].size()};
+
+        success &= reader.parse(dom) && copy(dom, targets[i]);
+      }
+
+      escape(success);
+      escape(targets);
+    });
+
+    return {"from_json_sample", ngc / buffer.size(), baseline / buffer.size()};
+  }
+};
+
+int main(int argc, char ** argv)
+{
+  return ngc_benchmark :: run(argc, argv, [](bool quick)
+  {
+    size_t rounds = quick ? 1 : 20;
+    std :: vector <sample> source = make_samples(quick ? 1000 : 100000);
+
+    return std :: vector <result>
+    {
+      to_json(rounds, source),
+      from_json(rounds, source)
+    };
+  });
+}
@@ -0,0 +1,152 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file log.cpp
+
+  This file includes the runtime benchmarks of \c ngc \c :: \c log and
+  \c ngc \c :: \c logger \c :: \c drain, against formatting the same line
+  with \c snprintf on the calling thread. Records are 40 byte \c trade
+  objects, and a batch fits in the ring of the calling thread, so that no
+  record is dropped. Times are per record.
+
+  \see reference/log/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 18, 2026
+*/
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "measure.h"
+#include "../test/parsed.h"
+#include "ngc/log.h"
+
+namespace
+{
+  using ngc_benchmark :: best;
+  using ngc_benchmark :: escape;
+  using ngc_benchmark :: result;
+
+  constexpr size_t line_size = 192;
+
+  std :: vector <trade> make_trades(size_t size)
+  {
+    std :: vector <trade> trades(size);
+
+    for(size_t i = 0; i < size; i++)
+    {
+      trades[i].id = 1000000 + i;
+      trades[i].price = 100 + (i % 1000) * 0.25;
+      trades[i].qty = (uint32_t) (i % 500);
+      trades[i].venue = (uint32_t) (i % 16);
+      trades[i].time = 1700000000000 + i;
+      trades[i].account = i % 1000;
+    }
+
+    return trades;
+  }
+
+  // Formats a trade as the same JSON line that drain appends.
+
+  inline int format(char * line, const trade & that)
+  {
+    return snprintf(line, line_size, "{\"id\":%" PRIu64 ",\"price\":%.17g,\"qty\":%" PRIu32 ",\"venue\":%" PRIu32 ",\"time\":%" PRIu64 ",\"account\":%" PRIu64 "}\n", that.id, that.price, that.qty, that.venue, that.time, that.account);
+  }
+
+  // Logging: the cost on the calling thread.
+
+  result log(size_t rounds, const std :: vector <trade> & source)
+  {
+    std :: string drained;
+    std :: vector <char> lines(source.size() * line_size);
+
+    double ngc = best(rounds, [&](){ drained.clear(); ngc :: logger :: drain(drained); }, [&]()
+    {
+      for(const trade & that : source)
+      {
+        bool logged = ngc :: log(that);
+        escape(logged);
+      }
+    });
+
+    ngc :: logger :: drain(drained);
+
+    double baseline = best(rounds, [](){}, [&]()
+    {
+      char * line = lines.data();
+
+      for(const trade & that : source)
+        line += format(line, that);
+
+      escape(lines);
+    });
+
+    return {"log_trade", ngc / source.size(), baseline / source.size()};
+  }
+
+  // Draining: the deferred cost of formatting, on the consumer thread.
+
+  result drain(size_t rounds, const std :: vector <trade> & source)
+  {
+    std :: string drained;
+    std :: vector <char> lines(source.size() * line_size);
+
+    drained.reserve(source.size() * line_size);
+
+    double ngc = best(rounds, [&]()
+    {
+      drained.clear();
+
+      for(const trade & that : source)
+        ngc :: log(that);
+    }, [&]()
+    {
+      ngc :: logger :: drain(drained);
+      escape(drained);
+    });
+
+    double baseline = best(rounds, [](){}, [&]()
+    {
+      char * line = lines.data();
+
+      for(const trade & that : source)
+        line += format(line, that);
+
+      escape(lines);
+    });
+
+    return {"drain_trade", ngc / source.size(), baseline / source.size()};
+  }
+};
+
+int main(int argc, char ** argv)
+{
+  return ngc_benchmark :: run(argc, argv, [](bool quick)
+  {
+    size_t rounds = quick ? 1 : 20;
+
+    // A record takes 56 bytes in the ring: a batch takes at most 10000 * 56
+    // bytes, and fits in the default ring of 1 MB.
+
+    std :: vector <trade> source = make_trades(quick ? 1000 : 10000);
+
+    return std :: vector <result>
+    {
+      log(rounds, source),
+      drain(rounds, source)
+    };
+  });
+}
@@ -0,0 +1,155 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file measure.h
+
+  This file includes the timing and reporting helpers shared by the benchmark
+  drivers: each driver times the same operations through the core library
+  and through their standard or hand-written equivalent, and writes the
+  results as JSON, to the standard output or to the file that follows
+  \c --output. \c --quick runs every benchmark only briefly, to check that
+  the benchmarks build and run.
+
+  \see benchmark/run.sh
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __benchmark__measure__h
+#define __benchmark__measure__h
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#ifndef NGC_BENCHMARK_FLAGS
+#define NGC_BENCHMARK_FLAGS ""
+#endif
+
+namespace ngc_benchmark
+{
+  /**
+    \fn escape
+    \brief Makes \c that escape to memory, so that the compiler can neither
+    drop the computations that produced it, nor move them out of the timed
+    loop.
+  */
+  template <typename type> inline void escape(const type & that)
+  {
+    asm volatile("" : : "r"(&that) : "memory");
+  }
+
+  /**
+    \class result
+    \brief The time per operation, in nanoseconds, of a benchmark through the
+    core library and through its equivalent.
+  */
+  struct result
+  {
+    const char * name;
+    double ngc;
+    double baseline;
+  };
+
+  /**
+    \fn best
+    \brief Runs \c setup, then times \c body, \c rounds times, and returns the
+    best time, in nanoseconds. \c setup is not timed.
+  */
+  template <typename stype, typename btype> double best(size_t rounds, stype && setup, btype && body)
+  {
+    double best = 0;
+
+    for(size_t round = 0; round < rounds; round++)
+    {
+      setup();
+
+      auto begin = std :: chrono :: steady_clock :: now();
+      body();
+      auto end = std :: chrono :: steady_clock :: now();
+
+      double elapsed = std :: chrono :: duration <double, std :: nano> (end - begin).count();
+
+      if(round == 0 || elapsed < best)
+        best = elapsed;
+    }
+
+    return best;
+  }
+
+  /**
+    \fn print
+    \brief Writes the results as JSON, together with the compiler and the
+    flags the benchmark was built with.
+  */
+  inline void print(FILE * file, const std :: vector <result> & results)
+  {
+#ifdef __clang__
+    const char * compiler = "clang " __clang_version__;
+#else
+    const char * compiler = "gcc " __VERSION__;
+#endif
+
+    fprintf(file, "{\n  \"compiler\": \"%s\",\n  \"flags\": \"%s\",\n  \"results\":\n  [\n", compiler, NGC_BENCHMARK_FLAGS);
+
+    for(size_t i = 0; i < results.size(); i++)
+      fprintf(file, "    {\"name\": \"%s\", \"ngc_ns\": %.3f, \"baseline_ns\": %.3f, \"ratio\": %.3f}%s\n", results[i].name, results[i].ngc, results[i].baseline, results[i].ngc / results[i].baseline, i + 1 < results.size() ? "," : "");
+
+    fprintf(file, "  ]\n}\n");
+  }
+
+  /**
+    \fn run
+    \brief Parses the command line, runs the benchmarks and writes their
+    results.
+    \param benchmarks A callable that takes \c true if \c --quick was given,
+    and returns the results of the benchmarks.
+    \return The exit status of the driver.
+  */
+  template <typename btype> int run(int argc, char ** argv, btype && benchmarks)
+  {
+    bool quick = false;
+    const char * output = nullptr;
+
+    for(int i = 1; i < argc; i++)
+      if(!strcmp(argv[i], "--quick"))
+        quick = true;
+      else if(!strcmp(argv[i], "--output") && i + 1 < argc)
+        output = argv[++i];
+      else
+      {
+        fprintf(stderr, "Usage: %s [--quick] [--output file]\n", argv[0]);
+        return 1;
+      }
+
+    std :: vector <result> results = benchmarks(quick);
+
+    FILE * file = output ? fopen(output, "w") : stdout;
+
+    if(!file)
+    {
+      fprintf(stderr, "Cannot open %s\n", output);
+      return 1;
+    }
+
+    print(file, results);
+
+    if(output)
+      fclose(file);
+
+    return 0;
+  }
+};
+
+#endif
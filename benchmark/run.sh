@@ -0,0 +1,48 @@
+#!/bin/sh
+#
+# Runs the core library benchmarks (every driver in NGC_BENCHMARK_DRIVERS, see
+# CMakeLists.txt) with every available compiler, at every optimization level,
+# and merges the results in a single JSON array:
+#
+#   benchmark/run.sh [output]
+#
+# output defaults to benchmark-results.json. The compilers are g++ and
+# clang++, or the ones listed in NGC_BENCHMARK_COMPILERS.
+
+set -e
+
+root=$(cd "$(dirname "$0")/.." && pwd)
+output=${1:-benchmark-results.json}
+compilers=${NGC_BENCHMARK_COMPILERS:-"g++ clang++"}
+build=$(mktemp -d)
+
+trap 'rm -rf "$build"' EXIT
+
+results=""
+
+for compiler in $compilers; do
+  if ! command -v "$compiler" > /dev/null; then
+    echo "Skipping $compiler: not found." >&2
+    continue
+  fi
+
+  cmake -S "$root" -B "$build/$compiler" -DCMAKE_CXX_COMPILER="$compiler" -DCMAKE_BUILD_TYPE= > /dev/null
+  cmake --build "$build/$compiler" --target benchmark > /dev/null
+
+  for file in "$build/$compiler"/benchmark/benchmark_*.json; do
+    results="$results $file"
+  done
+done
+
+{
+  echo "["
+  first=1
+  for file in $results; do
+    [ $first = 1 ] || echo ","
+    first=0
+    cat "$file"
+  done
+  echo "]"
+} > "$output"
+
+echo "Results written to $output." >&2
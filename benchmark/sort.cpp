@@ -0,0 +1,184 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file sort.cpp
+
+  This file includes the runtime benchmarks of \c ngc \c :: \c sort_by,
+  \c ngc \c :: \c sorted_indices and \c ngc \c :: \c sorted_index, against
+  \c std \c :: \c sort, \c std \c :: \c stable_sort and \c std \c ::
+  \c lower_bound. Records are 40 byte \c trade objects, with uniformly
+  distributed keys. Times are per record sorted, or per lookup.
+
+  \see reference/sort/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "measure.h"
+#include "../test/parsed.h"
+#include "ngc/sort.h"
+
+namespace
+{
+  using ngc_benchmark :: best;
+  using ngc_benchmark :: escape;
+  using ngc_benchmark :: result;
+
+  std :: vector <trade> make_trades(size_t size)
+  {
+    std :: mt19937_64 random(42);
+    std :: vector <trade> trades(size);
+
+    for(size_t i = 0; i < size; i++)
+    {
+      trades[i].id = random();
+      trades[i].price = std :: uniform_real_distribution <double> (0, 1000)(random);
+      trades[i].qty = (uint32_t) random();
+      trades[i].venue = (uint32_t) (i % 16);
+      trades[i].time = i;
+      trades[i].account = random() % 1000;
+    }
+
+    return trades;
+  }
+
+  // Sorting
+
+  result sort_by_qty(size_t rounds, const std :: vector <trade> & source)
+  {
+    std :: vector <trade> trades;
+
+    double ngc = best(rounds, [&](){ trades = source; }, [&]()
+    {
+      ngc :: sort_by(trades, ngc :: string <'q', 't', 'y'> {});
+      escape(trades);
+    });
+
+    double baseline = best(rounds, [&](){ trades = source; }, [&]()
+    {
+      std :: sort(trades.begin(), trades.end(), [](const trade & left, const trade & right)
+      {
+        return left.qty < right.qty;
+      });
+
+      escape(trades);
+    });
+
+    return {"sort_by_uint32", ngc / source.size(), baseline / source.size()};
+  }
+
+  result sort_by_price(size_t rounds, const std :: vector <trade> & source)
+  {
+    std :: vector <trade> trades;
+
+    double ngc = best(rounds, [&](){ trades = source; }, [&]()
+    {
+      ngc :: sort_by(trades, ngc :: string <'p', 'r', 'i', 'c', 'e'> {});
+      escape(trades);
+    });
+
+    double baseline = best(rounds, [&](){ trades = source; }, [&]()
+    {
+      std :: stable_sort(trades.begin(), trades.end(), [](const trade & left, const trade & right)
+      {
+        return left.price < right.price;
+      });
+
+      escape(trades);
+    });
+
+    return {"sort_by_double", ngc / source.size(), baseline / source.size()};
+  }
+
+  result sorted_indices(size_t rounds, const std :: vector <trade> & source)
+  {
+    std :: vector <uint32_t> keys;
+
+    double ngc = best(rounds, [](){}, [&]()
+    {
+      std :: vector <size_t> order = ngc :: sorted_indices(source, ngc :: string <'q', 't', 'y'> {});
+      escape(order);
+    });
+
+    double baseline = best(rounds, [&]()
+    {
+      keys.resize(source.size());
+
+      for(size_t i = 0; i < source.size(); i++)
+        keys[i] = source[i].qty;
+    }, [&]()
+    {
+      std :: sort(keys.begin(), keys.end());
+      escape(keys);
+    });
+
+    return {"sorted_indices_uint32", ngc / source.size(), baseline / source.size()};
+  }
+
+  // Lookups
+
+  result interpolate(size_t rounds, const std :: vector <trade> & source)
+  {
+    auto index = ngc :: index_by(source, ngc :: string <'i', 'd'> {});
+
+    std :: mt19937_64 random(7);
+    std :: vector <uint64_t> probes(source.size());
+
+    for(uint64_t & probe : probes)
+      probe = random();
+
+    double ngc = best(rounds, [](){}, [&]()
+    {
+      size_t sum = 0;
+
+      for(uint64_t probe : probes)
+        sum += index.interpolate(probe);
+
+      escape(sum);
+    });
+
+    double baseline = best(rounds, [](){}, [&]()
+    {
+      size_t sum = 0;
+
+      for(uint64_t probe : probes)
+        sum += index.lower_bound(probe);
+
+      escape(sum);
+    });
+
+    return {"interpolate_uint64", ngc / probes.size(), baseline / probes.size()};
+  }
+};
+
+int main(int argc, char ** argv)
+{
+  return ngc_benchmark :: run(argc, argv, [](bool quick)
+  {
+    size_t rounds = quick ? 1 : 5;
+    std :: vector <trade> source = make_trades(quick ? 10000 : 1000000);
+
+    return std :: vector <result>
+    {
+      sort_by_qty(rounds, source),
+      sort_by_price(rounds, source),
+      sorted_indices(rounds, source),
+      interpolate(rounds, source)
+    };
+  });
+}
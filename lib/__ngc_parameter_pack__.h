@@ -24,6 +24,10 @@
   \c __ngc_parameter_pack__ to concatenate them and reverse their order
   respectively.
 
+  \c __ngc_index_pack__ and \c __ngc_make_index_pack__ do the same for sets of
+  indexes, and are used to iterate on the members and base classes of a class
+  with a pack expansion rather than with a recursion.
+
   \author Matteo Monti [matteo.monti@rain.vg]
   \version 0.0.1
   \date Jul 07, 2016
@@ -32,6 +36,8 @@
 #ifndef __lib____ngc_parameter_pack____h
 #define __lib____ngc_parameter_pack____h
 
+#include <cstddef>
+
 /**
   \class __ngc_parameter_pack__
   \brief A variadic wrapper for type template parameters.
@@ -94,6 +100,15 @@ template <typename... alphas, typename... betas> struct __ngc_concatenate_parame
   typename with an \c __ngc_parameter_pack__ wrapping the elements in the
   \c __ngc_parameter_pack__ provided, in reversed order.
 
+  The elements are reversed by a single fold expression over
+  \c operator \c +, that prepends the elements of its right operand to those
+  of its left operand, so that packs of thousands of elements do not hit the
+  compiler's template instantiation depth limit. Each step of the fold,
+  however, produces a pack one element longer than the previous one: time
+  and memory grow quadratically with the size of \c pack (see the build cost
+  notes in reference/reference.md). The core library does not reverse packs
+  on its own paths.
+
   Note: empty \c __ngc_parameter_pack__ is allowed.
 
   \code
@@ -108,14 +123,103 @@ template <typename... alphas, typename... betas> struct __ngc_concatenate_parame
 */
 template <typename pack> struct __ngc_reverse_parameter_pack__;
 
-template <> struct __ngc_reverse_parameter_pack__ <__ngc_parameter_pack__ <>>
+template <typename... ptypes> struct __ngc_reverse_parameter_pack__ <__ngc_parameter_pack__ <ptypes...>>
+{
+  /**
+    \class wrapper
+    \brief A complete type wrapping a \c __ngc_parameter_pack__, so that it
+    can be an operand of \c operator \c +.
+  */
+  template <typename wpack> struct wrapper
+  {
+    typedef wpack type; /**< The wrapped \c __ngc_parameter_pack__. */
+  };
+
+  /**
+    \fn operator +
+    \brief Declared only, to prepend in unevaluated context the types in
+    \c beta to the types in \c alpha.
+  */
+  template <typename... alphas, typename... betas> friend wrapper <__ngc_parameter_pack__ <betas..., alphas...>> operator + (wrapper <__ngc_parameter_pack__ <alphas...>>, wrapper <__ngc_parameter_pack__ <betas...>>);
+
+  typedef typename decltype((wrapper <__ngc_parameter_pack__ <>> {} + ... + wrapper <__ngc_parameter_pack__ <ptypes>> {})) :: type type; /**< \c __ngc_parameter_pack__ wrapping the types in \c pack, in reversed order. */
+};
+
+/**
+  \class __ngc_index_pack__
+  \brief A variadic wrapper for \c size_t template parameters.
+
+  An \c __ngc_index_pack__ is the \c size_t counterpart of
+  \c __ngc_parameter_pack__. A function that is provided with an
+  \c __ngc_index_pack__ can expand its indexes in a single pack expansion, e.g.,
+  to iterate on the members of a class without recursing once per member.
+
+  The core library uses its own index pack rather than
+  \c std \c :: \c index_sequence, so that it only depends on the standard type
+  traits (see the module notes in reference/reference.md).
+
+  \code
+  template <size_t... indexes> void f(__ngc_index_pack__ <indexes...>);
+  // ...
+  f(typename __ngc_make_index_pack__ <3> :: type {}); // indexes... is 0, 1, 2
+  \endcode
+
+  \param indexes... A variadic set of \c size_t template parameters.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+template <size_t... indexes> struct __ngc_index_pack__
+{
+};
+
+/**
+  \class __ngc_make_index_pack__
+  \brief A service class to build the \c __ngc_index_pack__ of the indexes
+  from \c 0 to \c size \c - \c 1.
+
+  Class \c __ngc_make_index_pack__ builds the indexes of each half of the
+  range separately, then joins them, shifting the second half by the size of
+  the first. The depth of the recursion is therefore logarithmic in \c size,
+  so that classes with thousands of members do not hit the compiler's
+  template instantiation depth limit.
+
+  \code
+  typename __ngc_make_index_pack__ <4> :: type; // __ngc_index_pack__ <0, 1, 2, 3>
+  \endcode
+
+  \param size The number of indexes.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+template <size_t size> struct __ngc_make_index_pack__
+{
+  /**
+    \class join
+    \brief Joins two \c __ngc_index_pack__, shifting the indexes of the second
+    by the number of indexes in the first.
+  */
+  template <typename alpha, typename beta> struct join;
+
+  template <size_t... alphas, size_t... betas> struct join <__ngc_index_pack__ <alphas...>, __ngc_index_pack__ <betas...>>
+  {
+    typedef __ngc_index_pack__ <alphas..., (sizeof...(alphas) + betas)...> type; /**< \c __ngc_index_pack__ wrapping the indexes in \c alpha, followed by the indexes in \c beta, shifted. */
+  };
+
+  typedef typename join <typename __ngc_make_index_pack__ <size / 2> :: type, typename __ngc_make_index_pack__ <size - size / 2> :: type> :: type type; /**< \c __ngc_index_pack__ wrapping the indexes from \c 0 to \c size \c - \c 1. */
+};
+
+template <> struct __ngc_make_index_pack__ <0>
 {
-  typedef __ngc_parameter_pack__ <> type; /**< \c __ngc_parameter_pack__ wrapping the types in \c pack, in reversed order. */
+  typedef __ngc_index_pack__ <> type; /**< An empty \c __ngc_index_pack__. */
 };
 
-template <typename ptype, typename... ptypes> struct __ngc_reverse_parameter_pack__ <__ngc_parameter_pack__ <ptype, ptypes...>>
+template <> struct __ngc_make_index_pack__ <1>
 {
-  typedef typename __ngc_concatenate_parameter_packs__ <typename __ngc_reverse_parameter_pack__ <__ngc_parameter_pack__<ptypes...>> :: type, __ngc_parameter_pack__ <ptype>> :: type type; /**< \c __ngc_parameter_pack__ wrapping the types in \c pack, in reversed order. */
+  typedef __ngc_index_pack__ <0> type; /**< \c __ngc_index_pack__ wrapping the index \c 0. */
 };
 
 #endif
@@ -0,0 +1,355 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file __ngc_instrument__.h
+
+  This file includes the declaration of the \c __ngc_instrument__ service class
+  and of its public interface \c instrument in namespace \c ngc. Together, they
+  implement the construction / destruction counting instrumentation mode of
+  the core library, and the export of object lifecycle traces.
+
+  The instrumentation mode is enabled by defining \c NGC_INSTRUMENT before
+  including \c ngc.h. When enabled, \c __ngc_construct__, \c __ngc_destruct__,
+  \c __ngc_initialize__, \c __ngc_embody__ and the engagement and
+  disengagement of optionals record, for every type they are called on, how
+  many times they were called. Arrays are recorded as a whole, then element
+  by element, both when constructed and when destructed. When
+  \c NGC_INSTRUMENT is not defined, this file is not included at all and no
+  instrumentation code is emitted whatsoever.
+
+  Please note that \c NGC_INSTRUMENT needs to be consistently defined (or not
+  defined) in every translation unit of the same program.
+
+  \code
+  #define NGC_INSTRUMENT
+  #include "ngc.h"
+
+  // ...
+
+  for(const auto & entry : ngc :: instrument :: collect())
+    std :: cout << entry.name << ": " << entry.count[ngc :: instrument :: construct] << " constructions, " << entry.bytes(ngc :: instrument :: construct) << " bytes." << std :: endl;
+  \endcode
+
+  Lifecycle events can also be traced with their timestamps, threads and
+  types, then dumped as a Chrome trace JSON file that can be opened in
+  \c chrome://tracing or any compatible trace viewer. Each traced object
+  appears as a slice that begins with its construction and ends with its
+  destruction. Slices are identified by the address and the type of the
+  object, so that an array and its first element, or an object and its first
+  member, appear as distinct, nested slices. Objects are sampled by address,
+  so that all the events of a sampled object are traced.
+
+  \code
+  ngc :: instrument :: trace(16); // Traces one object in 16.
+
+  // ...
+
+  ngc :: instrument :: dump("ngc.trace.json");
+  \endcode
+
+  \see reference/optional/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __lib__instrument____ngc_instrument____h
+#define __lib__instrument____ngc_instrument____h
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+  \class __ngc_instrument__
+  \brief Service class that stores the per-type counters of the
+  instrumentation mode.
+
+  Class \c __ngc_instrument__ keeps a \c buffer of counters for every thread.
+  Recording an event only increments a counter in the buffer of the calling
+  thread: no lock is taken and no memory is shared with other threads on the
+  hot path. Buffers are aggregated on demand, by \c ngc \c :: \c instrument
+  \c :: \c collect, under the lock of the global \c registry.
+
+  Every instrumented type is enrolled in the \c registry the first time one
+  of its events is recorded, and is given a progressive id that indexes the
+  counters in every \c buffer.
+
+  \code
+  __ngc_instrument__ :: record <myclass> (__ngc_instrument__ :: construct, &my_object); // Counts a construction of a myclass object in the calling thread.
+  \endcode
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+struct __ngc_instrument__
+{
+  /**
+    \brief The events counted by the instrumentation mode.
+  */
+  enum event
+  {
+    construct, /**< A call to \c __ngc_construct__. */
+    destruct, /**< A call to \c __ngc_destruct__. */
+    initialize, /**< A call to \c __ngc_initialize__. */
+    embody, /**< A call to \c __ngc_embody__. */
+    engage, /**< An optional was set to an existing value. */
+    disengage, /**< An optional was set to its non-existing state. */
+    events /**< The number of events. */
+  };
+
+  /**
+    \class counter
+    \brief The counters of the events recorded on a type by a thread.
+
+    Counters are only written by the thread that owns them, and read by the
+    thread that aggregates them. Relaxed atomics are therefore enough, and
+    compile to plain loads and stores.
+  */
+  struct counter
+  {
+    std :: atomic <uint64_t> count[events]; /**< The number of events recorded, for each event. */
+  };
+
+  /**
+    \class descriptor
+    \brief Name and size of an instrumented type.
+  */
+  struct descriptor
+  {
+    const char * name; /**< The name of the type, as returned by \c typeid. */
+    size_t size; /**< The size of the type in bytes. */
+  };
+
+  /**
+    \class sample
+    \brief A traced event.
+  */
+  struct sample
+  {
+    uint64_t time; /**< The time of the event in nanoseconds, since tracing started. */
+    const void * address; /**< The address of the object. */
+    size_t id; /**< The id of the type of the object. */
+    event what; /**< The event. */
+    uint32_t thread; /**< The id of the thread that recorded the event. */
+  };
+
+  /**
+    \class buffer
+    \brief The thread-local store of counters and traced events.
+
+    A \c buffer stores its counters in blocks of \c block_size counters each,
+    that are allocated the first time a type with an id in their range is
+    recorded. Blocks are never moved, so that the aggregating thread can read
+    them while the owning thread keeps allocating new ones.
+
+    Traced events are appended to \c samples under \c mutex, which is only
+    contended while the trace is being dumped.
+
+    A \c buffer registers itself in the \c registry upon construction. Upon
+    thread exit, its counts and samples are retired into the \c registry so
+    that they are not lost when the thread terminates.
+  */
+  struct buffer
+  {
+    static constexpr size_t block_size = 64; /**< The number of counters in each block. */
+    static constexpr size_t max_blocks = 1024; /**< The maximum number of blocks, i.e., of instrumented types divided by \c block_size. */
+    static constexpr size_t max_types = block_size * max_blocks; /**< The maximum number of instrumented types. The events on types enrolled after the first \c max_types are dropped. */
+
+    std :: atomic <counter *> blocks[max_blocks]; /**< The blocks of counters, \c nullptr if not allocated yet. */
+
+    uint32_t thread; /**< The progressive id of the thread that owns the \c buffer. */
+    std :: mutex mutex; /**< Protects \c samples. */
+    std :: vector <sample> samples; /**< The events traced by the thread. */
+
+    /**
+      \brief Constructs an empty \c buffer and registers it in the \c registry.
+    */
+    buffer();
+
+    /**
+      \brief Retires the counts in the \c buffer into the \c registry, then
+      unregisters it and deallocates its blocks.
+    */
+    ~buffer();
+
+    /**
+      \brief Returns the counter of the type with the given id, allocating its
+      block if necessary.
+      \param id The id of the type, asserted to be smaller than \c max_types.
+      \return A reference to the counter of the type.
+    */
+    inline counter & at(size_t id);
+  };
+
+  /**
+    \class registry
+    \brief The global, lock-protected store of instrumented types and thread
+    buffers.
+  */
+  struct registry
+  {
+    std :: mutex mutex; /**< Protects all the members of the \c registry. */
+
+    std :: vector <descriptor> types; /**< The descriptors of the instrumented types, indexed by id. */
+    std :: vector <buffer *> buffers; /**< The buffers of the running threads. */
+    std :: vector <uint64_t> retired; /**< The counts retired by terminated threads, \c events entries per type. */
+    std :: vector <sample> samples; /**< The events traced by terminated threads. */
+
+    uint32_t threads = 0; /**< The number of threads that registered a \c buffer so far. */
+
+    std :: atomic <size_t> sampling {0}; /**< One object in \c sampling is traced, none if \c 0. */
+    std :: atomic <uint64_t> start {0}; /**< The time tracing started, in nanoseconds since the epoch of \c std \c :: \c chrono \c :: \c steady_clock. It is stored before \c sampling is released, so that a thread that acquires a non-zero \c sampling reads the matching \c start. */
+  };
+
+  /**
+    \brief Returns the global \c registry.
+  */
+  static inline registry & global();
+
+  /**
+    \brief Returns the \c buffer of the calling thread.
+  */
+  static inline buffer & local();
+
+  /**
+    \brief Returns the current time of \c std \c :: \c chrono \c ::
+    \c steady_clock, in nanoseconds since its epoch.
+  */
+  static inline uint64_t now();
+
+  /**
+    \brief Enrolls a type in the \c registry, returns its id.
+    \param name The name of the type.
+    \param size The size of the type.
+  */
+  static inline size_t enroll(const char * name, size_t size);
+
+  /**
+    \brief Returns the id of \c type, enrolling it the first time.
+    \param type The type whose id to retrieve.
+  */
+  template <typename type> static inline size_t id();
+
+  /**
+    \brief Returns the demangled name of a type, if possible.
+    \param name The name of the type, as returned by \c typeid.
+  */
+  static inline std :: string demangle(const char * name);
+
+  /**
+    \brief Determines if the events on an object need to be traced.
+
+    Objects are sampled by hashing their address, so that either all or none
+    of the events on the same object are traced.
+
+    \param address The address of the object.
+    \param sampling The sampling rate.
+  */
+  static inline bool sampled(const void * address, size_t sampling);
+
+  /**
+    \brief Counts an event on \c type in the calling thread, and traces it if
+    tracing is enabled and the object is sampled. The event is dropped if
+    \c type was enrolled after the first \c buffer \c :: \c max_types types.
+    \param type The type on which the event occurred.
+    \param what The event that occurred.
+    \param address The address of the object.
+  */
+  template <typename type> static inline void record(event what, const void * address);
+};
+
+namespace ngc
+{
+  /**
+    \class instrument
+    \brief Public interface to the instrumentation mode.
+
+    Class \c instrument exposes the events counted by the instrumentation mode
+    and the \c collect method that aggregates the counters of all threads.
+
+    \author agent [agent@local]
+    \version 0.0.1
+    \date Oct 17, 2026
+  */
+  struct instrument
+  {
+    typedef __ngc_instrument__ :: event event; /**< The events counted by the instrumentation mode. */
+
+    static constexpr event construct = __ngc_instrument__ :: construct; /**< A call to \c __ngc_construct__. */
+    static constexpr event destruct = __ngc_instrument__ :: destruct; /**< A call to \c __ngc_destruct__. */
+    static constexpr event initialize = __ngc_instrument__ :: initialize; /**< A call to \c __ngc_initialize__. */
+    static constexpr event embody = __ngc_instrument__ :: embody; /**< A call to \c __ngc_embody__. */
+    static constexpr event engage = __ngc_instrument__ :: engage; /**< An optional was set to an existing value. */
+    static constexpr event disengage = __ngc_instrument__ :: disengage; /**< An optional was set to its non-existing state. */
+    static constexpr size_t events = __ngc_instrument__ :: events; /**< The number of events. */
+
+    /**
+      \class entry
+      \brief The aggregated counts of an instrumented type.
+    */
+    struct entry
+    {
+      std :: string name; /**< The name of the type, demangled if possible. */
+      size_t size; /**< The size of the type in bytes. */
+      uint64_t count[events]; /**< The number of events recorded on the type, for each event. */
+
+      /**
+        \brief Returns the number of bytes affected by an event.
+        \param what The event.
+        \return The number of times \c what occurred, times the size of the type.
+      */
+      inline uint64_t bytes(event what) const;
+    };
+
+    /**
+      \brief Aggregates the counts of all running and terminated threads.
+
+      This takes the lock of the \c registry, but does not stop any thread
+      from recording events: counts recorded while \c collect runs may or may
+      not be included.
+
+      \return An \c entry for each type on which at least one event was
+      recorded.
+    */
+    static inline std :: vector <entry> collect();
+
+    /**
+      \brief Starts tracing lifecycle events, or stops it.
+
+      Calling \c trace again restarts the trace: the events traced so far are
+      discarded.
+
+      \param sampling One object in \c sampling will be traced. \c 1 traces
+      every object, \c 0 stops tracing.
+    */
+    static inline void trace(size_t sampling);
+
+    /**
+      \brief Writes the events traced so far to a file, in Chrome trace JSON
+      format.
+
+      \param path The path of the file to write.
+      \return \c true if the file was successfully written, \c false
+      otherwise.
+    */
+    static inline bool dump(const char * path);
+  };
+};
+
+#endif
@@ -0,0 +1,283 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+*/
+
+#ifndef __lib__instrument____ngc_instrument____hpp
+#define __lib__instrument____ngc_instrument____hpp
+
+#include <cstdio>
+#include <typeinfo>
+
+#if defined(__GNUG__)
+#include <cstdlib>
+#include <cxxabi.h>
+#endif
+
+inline __ngc_instrument__ :: buffer :: buffer()
+{
+  for(size_t i = 0; i < max_blocks; i++)
+    this->blocks[i].store(nullptr, std :: memory_order_relaxed);
+
+  registry & global = __ngc_instrument__ :: global();
+  std :: lock_guard <std :: mutex> lock(global.mutex);
+
+  this->thread = global.threads++;
+  global.buffers.push_back(this);
+}
+
+inline __ngc_instrument__ :: buffer :: ~buffer()
+{
+  registry & global = __ngc_instrument__ :: global();
+  std :: lock_guard <std :: mutex> lock(global.mutex);
+
+  for(size_t i = 0; i < max_blocks; i++)
+  {
+    counter * block = this->blocks[i].load(std :: memory_order_relaxed);
+
+    if(!block)
+      continue;
+
+    for(size_t j = 0; j < block_size; j++)
+      for(size_t e = 0; e < events; e++)
+      {
+        size_t slot = (i * block_size + j) * events + e;
+
+        if(slot < global.retired.size())
+          global.retired[slot] += block[j].count[e].load(std :: memory_order_relaxed);
+      }
+
+    delete [] block;
+  }
+
+  std :: lock_guard <std :: mutex> samples_lock(this->mutex);
+  global.samples.insert(global.samples.end(), this->samples.begin(), this->samples.end());
+
+  for(size_t i = 0; i < global.buffers.size(); i++)
+    if(global.buffers[i] == this)
+    {
+      global.buffers.erase(global.buffers.begin() + i);
+      break;
+    }
+}
+
+inline __ngc_instrument__ :: counter & __ngc_instrument__ :: buffer :: at(size_t id)
+{
+  assert(id < max_types && "Too many instrumented types.");
+
+  counter * block = this->blocks[id / block_size].load(std :: memory_order_relaxed);
+
+  if(!block)
+  {
+    block = new counter[block_size];
+
+    for(size_t j = 0; j < block_size; j++)
+      for(size_t e = 0; e < events; e++)
+        block[j].count[e].store(0, std :: memory_order_relaxed);
+
+    this->blocks[id / block_size].store(block, std :: memory_order_release);
+  }
+
+  return block[id % block_size];
+}
+
+inline __ngc_instrument__ :: registry & __ngc_instrument__ :: global()
+{
+  static registry instance;
+  return instance;
+}
+
+inline __ngc_instrument__ :: buffer & __ngc_instrument__ :: local()
+{
+  static thread_local buffer instance;
+  return instance;
+}
+
+inline uint64_t __ngc_instrument__ :: now()
+{
+  return std :: chrono :: duration_cast <std :: chrono :: nanoseconds> (std :: chrono :: steady_clock :: now().time_since_epoch()).count();
+}
+
+inline size_t __ngc_instrument__ :: enroll(const char * name, size_t size)
+{
+  registry & global = __ngc_instrument__ :: global();
+  std :: lock_guard <std :: mutex> lock(global.mutex);
+
+  global.types.push_back(descriptor {name, size});
+  global.retired.resize(global.types.size() * events, 0);
+
+  return global.types.size() - 1;
+}
+
+template <typename type> inline size_t __ngc_instrument__ :: id()
+{
+  static const size_t value = enroll(typeid(type).name(), sizeof(type));
+  return value;
+}
+
+inline std :: string __ngc_instrument__ :: demangle(const char * name)
+{
+  std :: string result = name;
+
+#if defined(__GNUG__)
+  int status;
+  char * demangled = abi :: __cxa_demangle(name, nullptr, nullptr, &status);
+
+  if(status == 0)
+    result = demangled;
+
+  std :: free(demangled);
+#endif
+
+  return result;
+}
+
+inline bool __ngc_instrument__ :: sampled(const void * address, size_t sampling)
+{
+  uint64_t hash = (uint64_t) (uintptr_t) address * 0x9e3779b97f4a7c15ull;
+  return (hash >> 32) % sampling == 0;
+}
+
+template <typename type> inline void __ngc_instrument__ :: record(event what, const void * address)
+{
+  buffer & local = __ngc_instrument__ :: local();
+  size_t id = __ngc_instrument__ :: id <type> ();
+
+  if(id >= buffer :: max_types)
+    return;
+
+  std :: atomic <uint64_t> & count = local.at(id).count[what];
+  count.store(count.load(std :: memory_order_relaxed) + 1, std :: memory_order_relaxed);
+
+  registry & global = __ngc_instrument__ :: global();
+  size_t sampling = global.sampling.load(std :: memory_order_acquire);
+
+  if(sampling && sampled(address, sampling))
+  {
+    uint64_t time = now() - global.start.load(std :: memory_order_relaxed);
+
+    std :: lock_guard <std :: mutex> lock(local.mutex);
+    local.samples.push_back(sample {time, address, id, what, local.thread});
+  }
+}
+
+namespace ngc
+{
+  inline uint64_t instrument :: entry :: bytes(event what) const
+  {
+    return this->count[what] * this->size;
+  }
+
+  inline std :: vector <instrument :: entry> instrument :: collect()
+  {
+    __ngc_instrument__ :: registry & global = __ngc_instrument__ :: global();
+    std :: lock_guard <std :: mutex> lock(global.mutex);
+
+    std :: vector <entry> entries;
+
+    for(size_t id = 0; id < global.types.size() && id < __ngc_instrument__ :: buffer :: max_types; id++)
+    {
+      entry item;
+      item.size = global.types[id].size;
+
+      bool recorded = false;
+
+      for(size_t e = 0; e < events; e++)
+      {
+        item.count[e] = global.retired[id * events + e];
+
+        for(__ngc_instrument__ :: buffer * local : global.buffers)
+        {
+          __ngc_instrument__ :: counter * block = local->blocks[id / __ngc_instrument__ :: buffer :: block_size].load(std :: memory_order_acquire);
+
+          if(block)
+            item.count[e] += block[id % __ngc_instrument__ :: buffer :: block_size].count[e].load(std :: memory_order_relaxed);
+        }
+
+        recorded = recorded || item.count[e];
+      }
+
+      if(!recorded)
+        continue;
+
+      item.name = __ngc_instrument__ :: demangle(global.types[id].name);
+      entries.push_back(item);
+    }
+
+    return entries;
+  }
+
+  inline void instrument :: trace(size_t sampling)
+  {
+    __ngc_instrument__ :: registry & global = __ngc_instrument__ :: global();
+    std :: lock_guard <std :: mutex> lock(global.mutex);
+
+    global.sampling.store(0, std :: memory_order_relaxed);
+
+    global.samples.clear();
+
+    for(__ngc_instrument__ :: buffer * local : global.buffers)
+    {
+      std :: lock_guard <std :: mutex> samples_lock(local->mutex);
+      local->samples.clear();
+    }
+
+    global.start.store(__ngc_instrument__ :: now(), std :: memory_order_relaxed);
+    global.sampling.store(sampling, std :: memory_order_release);
+  }
+
+  inline bool instrument :: dump(const char * path)
+  {
+    static const char * const phases[__ngc_instrument__ :: events] = {"b", "e", "n", "n", "n", "n"};
+    static const char * const names[__ngc_instrument__ :: events] = {"construct", "destruct", "initialize", "embody", "engage", "disengage"};
+
+    __ngc_instrument__ :: registry & global = __ngc_instrument__ :: global();
+    std :: lock_guard <std :: mutex> lock(global.mutex);
+
+    std :: vector <__ngc_instrument__ :: sample> samples = global.samples;
+
+    for(__ngc_instrument__ :: buffer * local : global.buffers)
+    {
+      std :: lock_guard <std :: mutex> samples_lock(local->mutex);
+      samples.insert(samples.end(), local->samples.begin(), local->samples.end());
+    }
+
+    std :: vector <std :: string> types;
+
+    for(const __ngc_instrument__ :: descriptor & type : global.types)
+    {
+      std :: string escaped;
+
+      for(char c : __ngc_instrument__ :: demangle(type.name))
+      {
+        if(c == '"' || c == '\\')
+          escaped += '\\';
+
+        escaped += c;
+      }
+
+      types.push_back(escaped);
+    }
+
+    FILE * file = fopen(path, "w");
+
+    if(!file)
+      return false;
+
+    fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+    for(size_t i = 0; i < samples.size(); i++)
+      fprintf(file, "%s\n{\"name\":\"%s\",\"cat\":\"ngc\",\"ph\":\"%s\",\"id\":\"%p:%zu\",\"ts\":%llu.%03llu,\"pid\":0,\"tid\":%u,\"args\":{\"event\":\"%s\"}}", i ? "," : "", types[samples[i].id].c_str(), phases[samples[i].what], samples[i].address, samples[i].id, (unsigned long long) (samples[i].time / 1000), (unsigned long long) (samples[i].time % 1000), (unsigned int) samples[i].thread, names[samples[i].what]);
+
+    fprintf(file, "\n]}\n");
+
+    return (fclose(file) == 0);
+  }
+};
+
+#endif
@@ -26,7 +26,9 @@
 #ifndef __lib__introspection____ngc_base_count____h
 #define __lib__introspection____ngc_base_count____h
 
+#include <cstddef>
 #include <cstdint>
+#include <type_traits>
 
 /**
  \class __ngc_base_count__
@@ -104,20 +106,56 @@ template <typename type> struct __ngc_base_count__
   };
 
   /**
-   \class iterator
-   \brief A nested service class used to evaluate the number of base classes in
-   a class.
+   \class bound
+   \brief A nested service class used to find an upper bound to the number of
+   base classes in \c type.
+
+   Class \c bound probes the existence of base 0, 1, 3, 7, 15 and so on
+   (i.e., of base 2^k - 1 for increasing k), making use of the service class
+   \c has_base, and stops at the first base class that does not exist. Since
+   base classes are indexed contiguously, the number of base classes is then
+   known to be between \c lower and \c upper.
+
+   Probing with exponentially growing steps keeps the depth of the recursion
+   logarithmic in the number of base classes, so that classes with thousands
+   of base classes do not hit the compiler's template instantiation depth
+   limit.
+
+   \param index The base class to be probed. For a successful counting of
+   base classes of the class should be set equal to 0.
+   \param more Boolean parameter which is set by default equal to
+   <tt>has_base <index> :: value<\tt>
+
+   \author agent [agent@local]
+   \version 0.0.1
+   \date Oct 17, 2026
+  */
+  template <size_t index, bool more = has_base <index> :: value> struct bound;
+
+  template <size_t index> struct bound <index, true>
+  {
+    static constexpr size_t lower = bound <2 * index + 1> :: lower; /**< If base \c index exists then the probe is delegated to base <tt>2 * index + 1<\tt>. */
+    static constexpr size_t upper = bound <2 * index + 1> :: upper; /**< If base \c index exists then the probe is delegated to base <tt>2 * index + 1<\tt>. */
+  };
+
+  template <size_t index> struct bound <index, false>
+  {
+    static constexpr size_t lower = (index + 1) / 2; /**< The base probed before \c index exists, so there are at least <tt>(index + 1) / 2<\tt> base classes. */
+    static constexpr size_t upper = index; /**< Base \c index does not exist, so there are at most \c index base classes. */
+  };
 
-   Class \c iterator is used to evaluate at compile-time, maxing use of the
-   service class \c has_base, the number of base classes of class \c type.
+  /**
+   \class search
+   \brief A nested service class used to evaluate the number of base classes in
+   \c type, provided with the bounds found by \c bound.
 
-   It does so through a recursion, checking whether \c type has base 0 and
-   if so progressively evaluating the existence of base n+1 after veryfying
-   the existence of base n. The recursion stops when no more bases are
-   present.
+   Class \c search does a binary search for the first base class that does not
+   exist, between \c lower (every base class before \c lower exists) and
+   \c upper (the base class at \c upper does not exist). Only the half of the
+   range that contains the result is instantiated at every step.
 
-   The result of the recursion is stored in class \c __ngc_base_count__ in
-   the variable \c value.
+   The result of the search is stored in class \c __ngc_base_count__ in the
+   variable \c value.
 
    \code
    class firstmom {};
@@ -129,31 +167,32 @@ template <typename type> struct __ngc_base_count__
 
    // After parser parses my_class ..
 
-   __ngc_base_count__ <my_class> :: value; // 2
+   __ngc_base_count__ <my_class> :: search <bound <0> :: lower, bound <0> :: upper> :: value // 2
    \endcode
 
-   \param index The integer indicating the starting point of the iteration. For
-   a successful counting of base classes of the class should be set equal to 0.
-   \param more Boolean parameter which is set by default equal to
-   <tt>has_base <index> :: value<\tt>
+   \param lower The lower end of the range.
+   \param upper The upper end of the range.
+   \param found Boolean parameter which is set by default equal to
+   <tt>lower == upper<\tt>
 
-   \author Matteo Monti [matteo.monti@rain.vg]
+   \author Matteo Monti [matteo.monti@rain.vg], agent [agent@local]
    \version 0.0.1
    \date Jul 22, 2016
-   */
-  template <size_t index, bool more = has_base <index> :: value> struct iterator;
+  */
+  template <size_t lower, size_t upper, bool found = (lower == upper)> struct search;
 
-  template <size_t index> struct iterator <index, true>
+  template <size_t lower, size_t upper> struct search <lower, upper, true>
   {
-    static constexpr size_t value = iterator <index + 1> :: value; /**< If base class \c index exists then a recursion is called and the evaluation of \c value is delegated to class <tt>iterator <index + 1><\tt>. */
+    static constexpr size_t value = lower; /**< If the range is empty then the search stops and the variable \c value is set equal to \c lower. */
   };
 
-  template <size_t index> struct iterator <index, false>
+  template <size_t lower, size_t upper> struct search <lower, upper, false>
   {
-    static constexpr size_t value = index; /**< If base class \c index does not exist then the recursion stops and the variable \c value is set equal to \c index. */
+    static constexpr size_t middle = lower + (upper - lower) / 2; /**< The base to be probed in this step. */
+    static constexpr size_t value = std :: conditional <has_base <middle> :: value, search <middle + 1, upper>, search <lower, middle>> :: type :: value; /**< The search is delegated to the upper half of the range if base \c middle exists, to the lower half otherwise. */
   };
 
-  static constexpr size_t value = iterator <0> :: value; /**< Class \c iterator is used here to recursively evaluate at compile-time the number of base classes of class \c type. */
+  static constexpr size_t value = search <bound <0> :: lower, bound <0> :: upper> :: value; /**< Classes \c bound and \c search are used here to evaluate at compile-time the number of base classes of class \c type. */
 };
 
 #endif
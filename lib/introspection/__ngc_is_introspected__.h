@@ -0,0 +1,84 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file __ngc_is_introspected__.h
+
+  This file includes the implementation of class \c __ngc_is_introspected__.
+  \c __ngc_is_introspected__ serves the purpose to determine wether or not a
+  class was fully processed by the introspection parser, i.e., if its members
+  and base classes can be iterated on.
+
+  \see reference/introspection/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __lib__introspection____ngc_is_introspected____h
+#define __lib__introspection____ngc_is_introspected____h
+
+#include <cstdint>
+#include <type_traits>
+
+/**
+  \class __ngc_is_introspected__
+  \brief Determines if a class was fully processed by the introspection
+  parser.
+
+  \c __ngc_is_introspected__ is a template class that, provided with a \c type
+  template parameter, sets its constexpr boolean \c value to \c true if and
+  only if \c type exposes the \c __ngc_member__ specializations of all its
+  members (and the \c __ngc_base__ specializations of all its base classes).
+
+  The parser marks every class it fully introspects with a public
+  \c __ngc_introspected__ typedef to the class itself. Since the typedef names
+  the class it was declared in, a class that inherits it from an introspected
+  base class is not mistaken for an introspected class. The cv-qualifiers of
+  \c type are ignored, so that a \c const introspected class is introspected
+  as well.
+
+  Classes that are not introspected are either classes that were not
+  processed by the parser at all (e.g., classes in the standard library) or,
+  in demand-driven introspection mode, classes that were never used
+  reflectively. The core library constructs and destructs them by calling
+  their actual constructors and destructor.
+
+  \code
+  class my_class
+  {
+    int i;
+  };
+
+  // After parser parses my_class ..
+
+  __ngc_is_introspected__ <my_class> :: value; // true
+  __ngc_is_introspected__ <const my_class> :: value; // true
+  __ngc_is_introspected__ <std :: string> :: value; // false
+  \endcode
+
+  \param type The template parameter representing the class to be inspected.
+
+  \see reference/introspection/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+template <typename type> struct __ngc_is_introspected__
+{
+  template <typename mtype> static int8_t test(typename std :: enable_if <std :: is_same <typename mtype :: __ngc_introspected__, mtype> :: value> :: type *);
+  template <typename mtype> static int32_t test(...);
+
+  static constexpr bool value = (sizeof(test <typename std :: remove_cv <type> :: type> (0)) == sizeof(int8_t)); /**< Through this sfinae the class inspects if \c type, stripped of its cv-qualifiers, has an \c __ngc_introspected__ typedef to itself. */
+};
+
+#endif
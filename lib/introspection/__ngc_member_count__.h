@@ -26,7 +26,9 @@
 #ifndef __lib__introspection____ngc_member_count____h
 #define __lib__introspection____ngc_member_count____h
 
+#include <cstddef>
 #include <cstdint>
+#include <type_traits>
 
 /**
   \class __ngc_member_count__
@@ -102,19 +104,55 @@ template <typename type> struct __ngc_member_count__
   };
 
   /**
-    \class iterator
-    \brief A nested service class used to evaluate the number of members in t.
+    \class bound
+    \brief A nested service class used to find an upper bound to the number of
+    members in \c type.
+
+    Class \c bound probes the existence of member 0, 1, 3, 7, 15 and so on
+    (i.e., of member 2^k - 1 for increasing k), making use of the service class
+    \c has_member, and stops at the first member that does not exist. Since
+    members are indexed contiguously, the number of members is then known to be
+    between \c lower and \c upper.
+
+    Probing with exponentially growing steps keeps the depth of the recursion
+    logarithmic in the number of members, so that classes with thousands of
+    members do not hit the compiler's template instantiation depth limit.
+
+    \param index The member to be probed. For a successful counting of
+    members of the class should be set equal to 0.
+    \param more Boolean parameter which is set by default equal to
+    <tt>has_member <index> :: value<\tt>
+
+    \author agent [agent@local]
+    \version 0.0.1
+    \date Oct 17, 2026
+  */
+  template <size_t index, bool more = has_member <index> :: value> struct bound;
+
+  template <size_t index> struct bound <index, true>
+  {
+    static constexpr size_t lower = bound <2 * index + 1> :: lower; /**< If member \c index exists then the probe is delegated to member <tt>2 * index + 1<\tt>. */
+    static constexpr size_t upper = bound <2 * index + 1> :: upper; /**< If member \c index exists then the probe is delegated to member <tt>2 * index + 1<\tt>. */
+  };
 
-    Class \c iterator is used to evaluate at compile-time, maxing use of the
-    service class \c has_member , the number of members of class \c type.
+  template <size_t index> struct bound <index, false>
+  {
+    static constexpr size_t lower = (index + 1) / 2; /**< The member probed before \c index exists, so there are at least <tt>(index + 1) / 2<\tt> members. */
+    static constexpr size_t upper = index; /**< Member \c index does not exist, so there are at most \c index members. */
+  };
+
+  /**
+    \class search
+    \brief A nested service class used to evaluate the number of members in
+    \c type, provided with the bounds found by \c bound.
 
-    It does so through a recursion, checking whether \c type has member 0 and
-    if so progressively evaluating the existence of member n+1 after veryfying
-    the existence of member n. The recursion stops when no more members are
-    present.
+    Class \c search does a binary search for the first member that does not
+    exist, between \c lower (every member before \c lower exists) and
+    \c upper (the member at \c upper does not exist). Only the half of the
+    range that contains the result is instantiated at every step.
 
-    The result of the recursion is stored in class \c __ngc_member_count__ in
-    the variable \c value.
+    The result of the search is stored in class \c __ngc_member_count__ in the
+    variable \c value.
 
     \code
     class my_class
@@ -125,31 +163,32 @@ template <typename type> struct __ngc_member_count__
 
     // After parser parses my_class ..
 
-    __ngc_member_count__ <my_class> :: iterator <0> :: value // 2
+    __ngc_member_count__ <my_class> :: search <bound <0> :: lower, bound <0> :: upper> :: value // 2
     \endcode
 
-    \param index The integer indicating the starting point of the iteration. For
-    a successful counting of members of the class should be set equal to 0.
-    \param more Boolean parameter which is set by default equal to
-    <tt>has_member <index> :: value<\tt>
+    \param lower The lower end of the range.
+    \param upper The upper end of the range.
+    \param found Boolean parameter which is set by default equal to
+    <tt>lower == upper<\tt>
 
-    \author Matteo Monti [matteo.monti@rain.vg]
+    \author Matteo Monti [matteo.monti@rain.vg], agent [agent@local]
     \version 0.0.1
     \date Jul 15, 2016
   */
-  template <size_t index, bool more = has_member <index> :: value> struct iterator;
+  template <size_t lower, size_t upper, bool found = (lower == upper)> struct search;
 
-  template <size_t index> struct iterator <index, true>
+  template <size_t lower, size_t upper> struct search <lower, upper, true>
   {
-    static constexpr size_t value = iterator <index + 1> :: value; /**< If member \c index exists then a recursion is called and the evaluation of \c value is delegated to class <tt>iterator <index + 1><\tt>. */
+    static constexpr size_t value = lower; /**< If the range is empty then the search stops and the variable \c value is set equal to \c lower. */
   };
 
-  template <size_t index> struct iterator <index, false>
+  template <size_t lower, size_t upper> struct search <lower, upper, false>
   {
-    static constexpr size_t value = index; /**< If member \c index does not exist then the recursion stops and the variable \c value is set equal to \c index. */
+    static constexpr size_t middle = lower + (upper - lower) / 2; /**< The member to be probed in this step. */
+    static constexpr size_t value = std :: conditional <has_member <middle> :: value, search <middle + 1, upper>, search <lower, middle>> :: type :: value; /**< The search is delegated to the upper half of the range if member \c middle exists, to the lower half otherwise. */
   };
 
-  static constexpr size_t value = iterator <0> :: value; /**< Class \c iterator is used here to recursively evaluate at compile-time the number of members of class \c type. */
+  static constexpr size_t value = search <bound <0> :: lower, bound <0> :: upper> :: value; /**< Classes \c bound and \c search are used here to evaluate at compile-time the number of members of class \c type. */
 };
 
 #endif
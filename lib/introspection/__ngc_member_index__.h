@@ -0,0 +1,83 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file __ngc_member_index__.h
+
+  This file includes the implementation of class \c __ngc_member_index__.
+  \c __ngc_member_index__ serves the purpose to determine, at compile time,
+  the index of the member of an introspected class that has a given name.
+
+  \see reference/introspection/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __lib__introspection____ngc_member_index____h
+#define __lib__introspection____ngc_member_index____h
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../__ngc_parameter_pack__.h"
+#include "__ngc_member_count__.h"
+
+/**
+  \class __ngc_member_index__
+  \brief Determines the index of the member of a class with a given name.
+
+  \c __ngc_member_index__ is a template class that, provided with a \c type
+  and a \c name template parameter, sets its constexpr \c value to the index
+  of the \c __ngc_member__ specialization of \c type whose \c name is
+  \c name. It fails at compile time if \c type has no such member. Members of
+  the base classes of \c type are not considered.
+
+  \code
+  class my_class
+  {
+    int i;
+    double j;
+  };
+
+  // After parser parses my_class ..
+
+  __ngc_member_index__ <my_class, decltype(`j`)> :: value; // 1
+  \endcode
+
+  \param type The template parameter representing the class to be inspected.
+  \param name The \c ngc \c :: \c string name of the member.
+
+  \see reference/introspection/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+template <typename type, typename name> struct __ngc_member_index__
+{
+  /**
+    \brief Returns the index of the member named \c name, or the number of
+    members of \c type if none is.
+  */
+  template <size_t... indexes> static constexpr size_t find(__ngc_index_pack__ <indexes...>)
+  {
+    size_t result = sizeof...(indexes);
+    ((std :: is_same <typename type :: template __ngc_member__ <indexes, false> :: name, name> :: value ? (result = indexes) : 0), ...);
+    return result;
+  }
+
+  static constexpr size_t value = find(typename __ngc_make_index_pack__ <__ngc_member_count__ <type> :: value> :: type {}); /**< The index of the member named \c name. */
+
+  static_assert(value < __ngc_member_count__ <type> :: value, "Class has no member with the given name.");
+};
+
+#endif
@@ -0,0 +1,327 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file from_json.h
+
+  This file includes the declaration of \c ngc \c :: \c from_json and of its
+  service class \c __ngc_json_reader__.
+
+  \c ngc \c :: \c from_json decodes JSON directly into an introspected object,
+  without building any intermediate representation of the document: each key
+  is compared with the \c ngc \c :: \c string names of the members of the
+  object, which are known at compile time, and its value is parsed straight
+  into the matching member.
+
+  \code
+  class point
+  {
+  public:
+    int x;
+    double y;
+  };
+
+  // After parser parses point ..
+
+  point p;
+  ngc :: from_json("{\"x\":1,\"y\":2.5}", p); // true, p.x is 1 and p.y is 2.5.
+  point q = ngc :: from_json <point> ("{\"x\":1,\"y\":2.5}"); // Throws std :: invalid_argument on error.
+  \endcode
+
+  \see reference/json/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __lib__json__from_json__h
+#define __lib__json__from_json__h
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "../__ngc_parameter_pack__.h"
+#include "../introspection/__ngc_member_count__.h"
+#include "../introspection/__ngc_base_count__.h"
+#include "../introspection/__ngc_is_introspected__.h"
+#include "../optional/__ngc_optional__.h"
+#include "../string/string.h"
+#include "to_json.h"
+
+/**
+  \class __ngc_json_reader__
+  \brief Service class for \c ngc \c :: \c from_json that implements the
+  scanning of JSON text and the decoding of values.
+
+  A JSON object is decoded into an introspected object member by member:
+  fields whose key matches no member (of the object or of its base classes)
+  are skipped, members whose key does not appear are left untouched. Values
+  are decoded according to the type of the member they are decoded into, with
+  the same rules \c __ngc_json_writer__ uses to encode them:
+
+   * Optionals are deleted (with \c __ngc_delete__) on \c null. Otherwise, an
+   optional that does not exist is engaged with \c __ngc_default__ first,
+   which default constructs the object it wraps with \c __ngc_construct__,
+   then the value is decoded into that object.
+   * \c bool, integral, enumeration and floating point values are decoded
+   with \c std \c :: \c from_chars.
+   * \c std \c :: \c string values are unescaped, including \c \\u escapes
+   and surrogate pairs, which are converted to UTF-8.
+   * Arrays of \c char are decoded from strings, which must fit in the array
+   with their null terminator. Other arrays are decoded element by element,
+   and must have at least as many elements as the JSON array. Containers
+   that expose \c clear and \c emplace_back are cleared, then decoded
+   element by element.
+
+  Skipped values are validated as strictly as decoded ones: a skipped object
+  or array must be well formed, with matching brackets and braces, and
+  every scalar in it must be valid.
+
+  Where SSE2 is available, strings (decoded or skipped) are scanned 16 bytes
+  at a time: the positions of quotes, backslashes and control characters in
+  a block are collected in a bitmap, and only the first set bit is visited.
+  The rest of the text (whitespace, structural characters, numbers and
+  literals) is scanned one byte at a time, and keys are compared with the
+  names of the members one after the other, with no trie.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+struct __ngc_json_reader__
+{
+  /**
+    \class cursor
+    \brief The position of the reader in the JSON text.
+  */
+  struct cursor
+  {
+    const char * position; /**< The next character to read. */
+    const char * end; /**< The end of the JSON text. */
+  };
+
+  /**
+    \class is_container
+    \brief Determines if a type is a container that can be cleared and
+    appended default constructed elements to.
+  */
+  template <typename type, typename = void> struct is_container : std :: false_type
+  {
+  };
+
+  template <typename type> struct is_container <type, std :: void_t <decltype(std :: declval <type &> ().clear()), decltype(std :: declval <type &> ().emplace_back())>> : std :: true_type
+  {
+  };
+
+  /**
+    \brief Skips whitespace.
+    \param that The cursor to advance.
+  */
+  static inline void whitespace(cursor & that);
+
+  /**
+    \brief Reads an expected character, after skipping whitespace.
+    \param that The cursor to advance.
+    \param character The expected character.
+    \return \c true if the character was read, \c false otherwise.
+  */
+  static inline bool expect(cursor & that, char character);
+
+  /**
+    \brief Reads a literal (e.g., \c true).
+    \param that The cursor to advance.
+    \param word The literal.
+    \param size The size of the literal.
+    \return \c true if the literal was read, \c false otherwise.
+  */
+  static inline bool literal(cursor & that, const char * word, size_t size);
+
+  /**
+    \brief Returns the position of the first quote, backslash or control
+    character in a range, or \c end if none.
+  */
+  static inline const char * quote(const char * position, const char * end);
+
+  /**
+    \brief Returns the end of the number that starts at \c position, or
+    \c nullptr if there is none.
+
+    Numbers follow the grammar of RFC 8259: an optional minus, then an
+    integer part with no leading zeros, an optional fraction and an optional
+    exponent. Unlike \c std \c :: \c from_chars, \c inf, \c nan, leading
+    zeros, a leading plus, and fractions or exponents with no digits are
+    rejected.
+  */
+  static inline const char * number(const char * position, const char * end);
+
+  /**
+    \brief Reads the four hexadecimal digits of a \c \\u escape.
+    \param that The cursor to advance.
+    \param code The code unit read.
+    \return \c true if four hexadecimal digits were read, \c false otherwise.
+  */
+  static inline bool hex(cursor & that, uint32_t & code);
+
+  /**
+    \brief Reads an escape, whose backslash was already read.
+
+    Both decoded and skipped strings read their escapes with this function,
+    so that a skipped string is rejected on the same escapes as a decoded
+    one: unknown escapes, \c \\u escapes without four hexadecimal digits, and
+    unpaired surrogates.
+
+    \param that The cursor to advance.
+    \param code The code point escaped (a surrogate pair is combined).
+    \return \c true if a valid escape was read, \c false otherwise.
+  */
+  static inline bool escape(cursor & that, uint32_t & code);
+
+  /**
+    \brief Reads a string, whose opening quote was already read, and
+    unescapes it.
+    \param that The cursor to advance.
+    \param target The string to assign the content to.
+    \return \c true if a valid string was read, \c false otherwise.
+  */
+  static inline bool string(cursor & that, std :: string & target);
+
+  /**
+    \brief Reads a key, whose opening quote was already read.
+
+    Keys without escapes are returned as a view on the JSON text. Keys with
+    escapes are unescaped into \c scratch.
+
+    \param that The cursor to advance.
+    \param key The key read.
+    \param scratch The storage for unescaped keys.
+    \return \c true if a valid key was read, \c false otherwise.
+  */
+  static inline bool key(cursor & that, std :: string_view & key, std :: string & scratch);
+
+  /**
+    \brief Skips a value of any type.
+    \param that The cursor to advance.
+    \return \c true if a valid value was skipped, \c false otherwise.
+  */
+  static inline bool skip(cursor & that);
+
+  /**
+    \brief Skips the key of a field, and the colon that follows it.
+    \param that The cursor to advance.
+    \return \c true if a valid key and a colon were skipped, \c false
+    otherwise.
+  */
+  static inline bool name(cursor & that);
+
+  /**
+    \brief Skips an object or an array, with all the values nested in it.
+
+    Nested objects and arrays are not skipped recursively: the closing
+    bracket or brace of each one that is open is kept on a stack, so that
+    the depth of nesting is only limited by memory, and a closing bracket
+    or brace must match the innermost open one.
+
+    \param that The cursor to advance, on the opening bracket or brace.
+    \return \c true if a valid object or array was skipped, \c false
+    otherwise.
+  */
+  static inline bool container(cursor & that);
+
+  /**
+    \brief Decodes the value of a field into the member of an introspected
+    object (or of one of its base classes) whose name matches its key.
+
+    The members of the object are matched first, then those of its base
+    classes, so that a member hides the members of its base classes with the
+    same name. Names are first compared by size, then by content: since both
+    sizes and contents are compile-time constants, each comparison compiles
+    to a few integer comparisons.
+
+    \param that The cursor to advance.
+    \param target The object.
+    \param key The key of the field.
+    \param success Set to \c false if a member matches and its value cannot
+    be decoded.
+    \return \c true if a member matches the key, \c false otherwise.
+  */
+  template <typename type> static inline bool field(cursor & that, type & target, std :: string_view key, bool & success);
+
+  /**
+    \brief Service overload of \c field that iterates on the members and on
+    the base classes of an introspected object.
+  */
+  template <typename type, size_t... bindexes, size_t... mindexes> static inline bool field(cursor & that, type & target, std :: string_view key, bool & success, __ngc_index_pack__ <bindexes...>, __ngc_index_pack__ <mindexes...>);
+
+  /**
+    \brief Decodes an object into an introspected object.
+    \param that The cursor to advance.
+    \param target The object.
+    \return \c true if a valid object was decoded, \c false otherwise.
+  */
+  template <typename type> static inline bool object(cursor & that, type & target);
+
+  /**
+    \brief Decodes an array into an array or a container.
+    \param that The cursor to advance.
+    \param target The array or container.
+    \return \c true if a valid array was decoded, \c false otherwise.
+  */
+  template <typename type> static inline bool array(cursor & that, type & target);
+
+  /**
+    \brief Decodes any value.
+    \param that The cursor to advance.
+    \param target The object to decode into.
+    \return \c true if a valid value was decoded, \c false otherwise.
+  */
+  template <typename type> static inline bool value(cursor & that, type & target);
+};
+
+namespace ngc
+{
+  /**
+    \fn from_json
+    \brief Decodes JSON into an existing object.
+
+    Decoding stops at the first error, leaving the members decoded so far
+    assigned. Trailing whitespace is allowed, anything else after the value
+    is an error.
+
+    \param json The JSON text.
+    \param that The object to decode into.
+    \return \c true if the JSON text was successfully decoded, \c false
+    otherwise.
+
+    \author agent [agent@local]
+    \version 0.0.1
+    \date Oct 17, 2026
+  */
+  template <typename type> inline bool from_json(std :: string_view json, type & that);
+
+  /**
+    \fn from_json
+    \brief Decodes JSON into a new, default constructed object.
+    \param json The JSON text.
+    \return The decoded object.
+    \throws std :: invalid_argument If the JSON text cannot be decoded.
+
+    \author agent [agent@local]
+    \version 0.0.1
+    \date Oct 17, 2026
+  */
+  template <typename type> inline type from_json(std :: string_view json);
+};
+
+#endif
@@ -0,0 +1,524 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+*/
+
+#ifndef __lib__json__from_json__hpp
+#define __lib__json__from_json__hpp
+
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__SSE2__) && defined(__GNUG__)
+#include <emmintrin.h>
+#endif
+
+inline void __ngc_json_reader__ :: whitespace(cursor & that)
+{
+  while(that.position < that.end && (*that.position == ' ' || *that.position == '\n' || *that.position == '\r' || *that.position == '\t'))
+    that.position++;
+}
+
+inline bool __ngc_json_reader__ :: expect(cursor & that, char character)
+{
+  whitespace(that);
+
+  if(that.position == that.end || *that.position != character)
+    return false;
+
+  that.position++;
+  return true;
+}
+
+inline bool __ngc_json_reader__ :: literal(cursor & that, const char * word, size_t size)
+{
+  if((size_t) (that.end - that.position) < size || std :: memcmp(that.position, word, size))
+    return false;
+
+  that.position += size;
+  return true;
+}
+
+inline const char * __ngc_json_reader__ :: quote(const char * position, const char * end)
+{
+#if defined(__SSE2__) && defined(__GNUG__)
+  const __m128i quotes = _mm_set1_epi8('"');
+  const __m128i backslashes = _mm_set1_epi8('\\');
+  const __m128i controls = _mm_set1_epi8(0x1f);
+
+  for(; end - position >= 16; position += 16)
+  {
+    __m128i block = _mm_loadu_si128((const __m128i *) position);
+    __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, quotes), _mm_cmpeq_epi8(block, backslashes)), _mm_cmpeq_epi8(_mm_min_epu8(block, controls), block));
+
+    unsigned int bitmap = _mm_movemask_epi8(special);
+
+    if(bitmap)
+      return position + __builtin_ctz(bitmap);
+  }
+#endif
+
+  for(; position < end; position++)
+    if(*position == '"' || *position == '\\' || (unsigned char) *position < 0x20)
+      return position;
+
+  return end;
+}
+
+inline const char * __ngc_json_reader__ :: number(const char * position, const char * end)
+{
+  if(position < end && *position == '-')
+    position++;
+
+  if(position == end || *position < '0' || *position > '9')
+    return nullptr;
+
+  if(*(position++) != '0')
+    while(position < end && *position >= '0' && *position <= '9')
+      position++;
+
+  if(position < end && *position == '.')
+  {
+    if(++position == end || *position < '0' || *position > '9')
+      return nullptr;
+
+    while(position < end && *position >= '0' && *position <= '9')
+      position++;
+  }
+
+  if(position < end && (*position == 'e' || *position == 'E'))
+  {
+    if(++position < end && (*position == '+' || *position == '-'))
+      position++;
+
+    if(position == end || *position < '0' || *position > '9')
+      return nullptr;
+
+    while(position < end && *position >= '0' && *position <= '9')
+      position++;
+  }
+
+  return position;
+}
+
+inline bool __ngc_json_reader__ :: hex(cursor & that, uint32_t & code)
+{
+  if(that.end - that.position < 4)
+    return false;
+
+  code = 0;
+
+  for(size_t i = 0; i < 4; i++)
+  {
+    char c = *(that.position++);
+
+    if(c >= '0' && c <= '9')
+      code = (code << 4) | (c - '0');
+    else if(c >= 'a' && c <= 'f')
+      code = (code << 4) | (c - 'a' + 10);
+    else if(c >= 'A' && c <= 'F')
+      code = (code << 4) | (c - 'A' + 10);
+    else
+      return false;
+  }
+
+  return true;
+}
+
+inline bool __ngc_json_reader__ :: escape(cursor & that, uint32_t & code)
+{
+  if(that.position == that.end)
+    return false;
+
+  switch(*(that.position++))
+  {
+    case '"': code = '"'; return true;
+    case '\\': code = '\\'; return true;
+    case '/': code = '/'; return true;
+    case 'b': code = '\b'; return true;
+    case 'f': code = '\f'; return true;
+    case 'n': code = '\n'; return true;
+    case 'r': code = '\r'; return true;
+    case 't': code = '\t'; return true;
+    case 'u':
+    {
+      if(!hex(that, code) || (code >= 0xdc00 && code < 0xe000))
+        return false;
+
+      if(code >= 0xd800 && code < 0xdc00)
+      {
+        uint32_t low;
+
+        if(!literal(that, "\\u", 2) || !hex(that, low) || low < 0xdc00 || low >= 0xe000)
+          return false;
+
+        code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+      }
+
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+inline bool __ngc_json_reader__ :: string(cursor & that, std :: string & target)
+{
+  target.clear();
+
+  while(true)
+  {
+    const char * special = quote(that.position, that.end);
+    target.append(that.position, special - that.position);
+    that.position = special;
+
+    if(that.position == that.end || (unsigned char) *that.position < 0x20)
+      return false;
+
+    if(*(that.position++) == '"')
+      return true;
+
+    uint32_t code;
+
+    if(!escape(that, code))
+      return false;
+
+    if(code < 0x80)
+      target += (char) code;
+    else if(code < 0x800)
+    {
+      char encoded[] = {(char) (0xc0 | (code >> 6)), (char) (0x80 | (code & 0x3f))};
+      target.append(encoded, sizeof(encoded));
+    }
+    else if(code < 0x10000)
+    {
+      char encoded[] = {(char) (0xe0 | (code >> 12)), (char) (0x80 | ((code >> 6) & 0x3f)), (char) (0x80 | (code & 0x3f))};
+      target.append(encoded, sizeof(encoded));
+    }
+    else
+    {
+      char encoded[] = {(char) (0xf0 | (code >> 18)), (char) (0x80 | ((code >> 12) & 0x3f)), (char) (0x80 | ((code >> 6) & 0x3f)), (char) (0x80 | (code & 0x3f))};
+      target.append(encoded, sizeof(encoded));
+    }
+  }
+}
+
+inline bool __ngc_json_reader__ :: key(cursor & that, std :: string_view & key, std :: string & scratch)
+{
+  const char * special = quote(that.position, that.end);
+
+  if(special < that.end && *special == '"')
+  {
+    key = std :: string_view(that.position, special - that.position);
+    that.position = special + 1;
+    return true;
+  }
+
+  if(!string(that, scratch))
+    return false;
+
+  key = scratch;
+  return true;
+}
+
+inline bool __ngc_json_reader__ :: skip(cursor & that)
+{
+  whitespace(that);
+
+  if(that.position == that.end)
+    return false;
+
+  switch(*that.position)
+  {
+    case '"':
+    {
+      that.position++;
+
+      while(true)
+      {
+        that.position = quote(that.position, that.end);
+
+        if(that.position == that.end || (unsigned char) *that.position < 0x20)
+          return false;
+
+        if(*(that.position++) == '"')
+          return true;
+
+        uint32_t code;
+
+        if(!escape(that, code))
+          return false;
+      }
+    }
+    case '[':
+    case '{':
+      return container(that);
+    case 't': return literal(that, "true", 4);
+    case 'f': return literal(that, "false", 5);
+    case 'n': return literal(that, "null", 4);
+    default:
+    {
+      const char * last = number(that.position, that.end);
+
+      if(!last)
+        return false;
+
+      that.position = last;
+      return true;
+    }
+  }
+}
+
+inline bool __ngc_json_reader__ :: name(cursor & that)
+{
+  whitespace(that);
+
+  if(that.position == that.end || *that.position != '"')
+    return false;
+
+  return skip(that) && expect(that, ':');
+}
+
+inline bool __ngc_json_reader__ :: container(cursor & that)
+{
+  std :: string closing; // The closing bracket or brace of each open container, innermost last.
+
+  while(true)
+  {
+    // A value starts here: containers are opened, scalars are skipped.
+
+    whitespace(that);
+
+    if(that.position < that.end && (*that.position == '[' || *that.position == '{'))
+    {
+      closing.push_back(*(that.position++) == '[' ? ']' : '}');
+
+      if(!expect(that, closing.back()))
+      {
+        if(closing.back() == '}' && !name(that))
+          return false;
+
+        continue;
+      }
+
+      closing.pop_back();
+    }
+    else if(!skip(that))
+      return false;
+
+    // A value ends here: either a comma follows, or its container is closed.
+
+    while(!closing.empty())
+    {
+      if(expect(that, ','))
+      {
+        if(closing.back() == '}' && !name(that))
+          return false;
+
+        break;
+      }
+
+      if(!expect(that, closing.back()))
+        return false;
+
+      closing.pop_back();
+    }
+
+    if(closing.empty())
+      return true;
+  }
+}
+
+template <typename type> inline bool __ngc_json_reader__ :: field(cursor & that, type & target, std :: string_view key, bool & success)
+{
+  return field(that, target, key, success, typename __ngc_make_index_pack__ <__ngc_base_count__ <type> :: value> :: type {}, typename __ngc_make_index_pack__ <__ngc_member_count__ <type> :: value> :: type {});
+}
+
+template <typename type, size_t... bindexes, size_t... mindexes> inline bool __ngc_json_reader__ :: field(cursor & that, type & target, std :: string_view key, bool & success, __ngc_index_pack__ <bindexes...>, __ngc_index_pack__ <mindexes...>)
+{
+  return ((key.size() == sizeof(type :: template __ngc_member__ <mindexes, false> :: name :: value) - 1 && !std :: memcmp(key.data(), type :: template __ngc_member__ <mindexes, false> :: name :: value, sizeof(type :: template __ngc_member__ <mindexes, false> :: name :: value) - 1) && ((success = value(that, type :: template __ngc_member__ <mindexes, false> :: get(target))), true)) || ...) || (field(that, (typename type :: template __ngc_base__ <bindexes, false> :: type &) target, key, success) || ...);
+}
+
+template <typename type> inline bool __ngc_json_reader__ :: object(cursor & that, type & target)
+{
+  if(!expect(that, '{'))
+    return false;
+
+  if(expect(that, '}'))
+    return true;
+
+  std :: string scratch;
+
+  while(true)
+  {
+    std :: string_view name;
+
+    if(!expect(that, '"') || !key(that, name, scratch) || !expect(that, ':'))
+      return false;
+
+    bool success = true;
+
+    if(!field(that, target, name, success))
+      success = skip(that);
+
+    if(!success)
+      return false;
+
+    if(expect(that, '}'))
+      return true;
+
+    if(!expect(that, ','))
+      return false;
+  }
+}
+
+template <typename type> inline bool __ngc_json_reader__ :: array(cursor & that, type & target)
+{
+  if(!expect(that, '['))
+    return false;
+
+  if constexpr(is_container <type> :: value)
+    target.clear();
+
+  if(expect(that, ']'))
+    return true;
+
+  for(size_t i = 0;; i++)
+  {
+    if constexpr(std :: is_array <type> :: value)
+    {
+      if(i == std :: extent <type> :: value || !value(that, target[i]))
+        return false;
+    }
+    else if(!value(that, target.emplace_back()))
+      return false;
+
+    if(expect(that, ']'))
+      return true;
+
+    if(!expect(that, ','))
+      return false;
+  }
+}
+
+template <typename type> inline bool __ngc_json_reader__ :: value(cursor & that, type & target)
+{
+  whitespace(that);
+
+  if constexpr(__ngc_json_writer__ :: is_optional <type> :: value)
+  {
+    if(literal(that, "null", 4))
+    {
+      target.__ngc_delete__();
+      return true;
+    }
+
+    if(!target.__ngc_exists__)
+      target(__ngc_default__);
+
+    return value(that, target.__ngc_embody__());
+  }
+  else if constexpr(std :: is_same <type, bool> :: value)
+  {
+    if(literal(that, "true", 4))
+      target = true;
+    else if(literal(that, "false", 5))
+      target = false;
+    else
+      return false;
+
+    return true;
+  }
+  else if constexpr(std :: is_enum <type> :: value)
+  {
+    typename std :: underlying_type <type> :: type underlying;
+
+    if(!value(that, underlying))
+      return false;
+
+    target = static_cast <type> (underlying);
+    return true;
+  }
+  else if constexpr(std :: is_arithmetic <type> :: value)
+  {
+    if constexpr(std :: is_floating_point <type> :: value)
+      if(literal(that, "null", 4))
+      {
+        target = std :: numeric_limits <type> :: quiet_NaN();
+        return true;
+      }
+
+    const char * last = number(that.position, that.end);
+
+    if(!last)
+      return false;
+
+    std :: from_chars_result result = std :: from_chars(that.position, last, target);
+
+    that.position = result.ptr;
+    return (result.ec == std :: errc() && result.ptr == last);
+  }
+  else if constexpr(std :: is_same <type, std :: nullptr_t> :: value)
+    return literal(that, "null", 4);
+  else if constexpr(std :: is_same <type, std :: string> :: value)
+    return (expect(that, '"') && string(that, target));
+  else if constexpr(std :: is_array <type> :: value && std :: is_same <typename std :: remove_extent <type> :: type, char> :: value)
+  {
+    std :: string content;
+
+    if(!expect(that, '"') || !string(that, content) || content.size() >= std :: extent <type> :: value)
+      return false;
+
+    std :: memcpy(target, content.data(), content.size());
+    target[content.size()] = '\0';
+
+    return true;
+  }
+  else if constexpr(__ngc_is_introspected__ <type> :: value)
+    return object(that, target);
+  else if constexpr(std :: is_array <type> :: value || is_container <type> :: value)
+    return array(that, target);
+  else if constexpr(std :: is_convertible <type, std :: string_view> :: value)
+  {
+    static_assert(std :: is_void <type> :: value, "String views and pointers do not own their characters, and cannot be deserialized from JSON: use std :: string.");
+    return false;
+  }
+  else
+  {
+    static_assert(std :: is_void <type> :: value, "Type cannot be deserialized from JSON.");
+    return false;
+  }
+}
+
+namespace ngc
+{
+  template <typename type> inline bool from_json(std :: string_view json, type & that)
+  {
+    __ngc_json_reader__ :: cursor cursor {json.data(), json.data() + json.size()};
+
+    if(!__ngc_json_reader__ :: value(cursor, that))
+      return false;
+
+    __ngc_json_reader__ :: whitespace(cursor);
+    return (cursor.position == cursor.end);
+  }
+
+  template <typename type> inline type from_json(std :: string_view json)
+  {
+    type that;
+
+    if(!from_json(json, that))
+      throw std :: invalid_argument("Malformed JSON, or JSON that does not match the type.");
+
+    return that;
+  }
+};
+
+#endif
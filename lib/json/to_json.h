@@ -0,0 +1,244 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file to_json.h
+
+  This file includes the declaration of \c ngc \c :: \c to_json and of its
+  service class \c __ngc_json_writer__.
+
+  \c ngc \c :: \c to_json serializes any introspected object to JSON. The
+  structure of the output, i.e., the braces, the quoted member names, the
+  colons and the commas, depends only on the type of the object, and is
+  computed at compile time from the \c ngc \c :: \c string names of its
+  members: serializing an object appends, for each member, one precomputed
+  fragment and its formatted value.
+
+  \code
+  class point
+  {
+  public:
+    int x;
+    double y;
+  };
+
+  // After parser parses point ..
+
+  point p = {1, 2.5};
+  std :: string buffer;
+  ngc :: to_json(p, buffer); // Appends {"x":1,"y":2.5} to buffer.
+  \endcode
+
+  \see reference/json/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __lib__json__to_json__h
+#define __lib__json__to_json__h
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "../__ngc_parameter_pack__.h"
+#include "../introspection/__ngc_member_count__.h"
+#include "../introspection/__ngc_base_count__.h"
+#include "../introspection/__ngc_is_introspected__.h"
+#include "../string/string.h"
+
+/**
+  \class __ngc_json_writer__
+  \brief Service class for \c ngc \c :: \c to_json that implements the
+  serialization of objects, values and strings.
+
+  An introspected object is serialized as a JSON object, whose fields are the
+  members of its base classes (in order of inheritance), followed by its own
+  members (in order of declaration). Other values are serialized according to
+  their type:
+
+   * Optionals are serialized as the object they wrap, or as \c null if they
+   do not exist.
+   * \c bool values are serialized as \c true or \c false.
+   * Integral (including \c char) and enumeration values are serialized as
+   numbers.
+   * Floating point values are serialized as the shortest number that reads
+   back to the same value, or as \c null if they are not finite.
+   * \c std \c :: \c string, \c std \c :: \c string_view, \c const \c char
+   \c * and \c char arrays are serialized as escaped JSON strings. A \c char
+   array is read up to its first null character, or up to its extent if it
+   has none. A null \c const \c char \c * is serialized as \c null.
+   * Arrays and containers (i.e., anything \c std \c :: \c begin and
+   \c std \c :: \c end can be called on) are serialized as JSON arrays.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+struct __ngc_json_writer__
+{
+  /**
+    \class key
+    \brief The compile-time fragment that precedes the value of a member.
+
+    The fragment of the first field of an object opens the object, e.g.,
+    \c {"x": for a member named \c x, the fragment of any other field
+    separates it from the previous one, e.g., \c ,"y": for a member named
+    \c y. Member names are identifiers, and never need to be escaped.
+
+    \param first \c true if the member is the first field of the object.
+    \param name The \c ngc \c :: \c string name of the member.
+  */
+  template <bool first, typename name> struct key;
+
+  template <bool first, char... chars> struct key <first, ngc :: string <chars...>>
+  {
+    static constexpr char value[] = {(first ? '{' : ','), '"', chars..., '"', ':'}; /**< The fragment. */
+    static constexpr size_t size = sizeof...(chars) + 4; /**< The size of the fragment. */
+  };
+
+  /**
+    \class fields
+    \brief Counts the fields of the JSON object an introspected class is
+    serialized to, i.e., its members and the members of its base classes.
+
+    \param type The introspected class.
+  */
+  template <typename type, typename = typename __ngc_make_index_pack__ <__ngc_base_count__ <type> :: value> :: type> struct fields;
+
+  template <typename type, size_t... indexes> struct fields <type, __ngc_index_pack__ <indexes...>>
+  {
+    static constexpr size_t counts[] = {fields <typename type :: template __ngc_base__ <indexes, false> :: type> :: value..., 0}; /**< The number of fields in each base class. */
+
+    static constexpr size_t bases = (0 + ... + fields <typename type :: template __ngc_base__ <indexes, false> :: type> :: value); /**< The number of fields in the base classes. */
+    static constexpr size_t value = bases + __ngc_member_count__ <type> :: value; /**< The number of fields. */
+
+    /**
+      \brief Returns the number of fields in the base classes that precede a
+      base class, i.e., the index of its first field.
+      \param index The index of the base class.
+    */
+    static constexpr size_t before(size_t index)
+    {
+      size_t sum = 0;
+
+      for(size_t i = 0; i < index; i++)
+        sum += counts[i];
+
+      return sum;
+    }
+  };
+
+  /**
+    \class is_optional
+    \brief Determines if a type is an optional, i.e., if it exposes both an
+    \c __ngc_exists__ flag and an \c __ngc_embody__ method.
+  */
+  template <typename type, typename = void> struct is_optional : std :: false_type
+  {
+  };
+
+  template <typename type> struct is_optional <type, std :: void_t <decltype(std :: declval <const type &> ().__ngc_exists__), decltype(std :: declval <const type &> ().__ngc_embody__())>> : std :: true_type
+  {
+  };
+
+  /**
+    \class is_range
+    \brief Determines if a type can be iterated on with \c std \c :: \c begin
+    and \c std \c :: \c end.
+  */
+  template <typename type, typename = void> struct is_range : std :: false_type
+  {
+  };
+
+  template <typename type> struct is_range <type, std :: void_t <decltype(std :: begin(std :: declval <const type &> ())), decltype(std :: end(std :: declval <const type &> ()))>> : std :: true_type
+  {
+  };
+
+  /**
+    \brief Appends a JSON string to a buffer, escaping its content.
+
+    Runs of characters that do not need to be escaped are appended with a
+    single call to \c append.
+
+    \param buffer The buffer to append to.
+    \param that The content of the string.
+  */
+  template <typename btype> static inline void string(btype & buffer, std :: string_view that);
+
+  /**
+    \brief Appends the fields of an introspected object to a buffer.
+    \param offset The index of the first field written, \c 0 if the object
+    is the outermost one.
+    \param buffer The buffer to append to.
+    \param that The object to serialize.
+  */
+  template <size_t offset, typename btype, typename type> static inline void members(btype & buffer, const type & that);
+
+  /**
+    \brief Service overload of \c members that iterates on the base classes
+    and on the members of an introspected object.
+  */
+  template <size_t offset, typename btype, typename type, size_t... bindexes, size_t... mindexes> static inline void members(btype & buffer, const type & that, __ngc_index_pack__ <bindexes...>, __ngc_index_pack__ <mindexes...>);
+
+  /**
+    \brief Appends an introspected object to a buffer.
+    \param buffer The buffer to append to.
+    \param that The object to serialize.
+  */
+  template <typename btype, typename type> static inline void object(btype & buffer, const type & that);
+
+  /**
+    \brief Appends any value to a buffer.
+    \param buffer The buffer to append to.
+    \param that The value to serialize.
+  */
+  template <typename btype, typename type> static inline void value(btype & buffer, const type & that);
+};
+
+namespace ngc
+{
+  /**
+    \fn to_json
+    \brief Appends the JSON serialization of an object to a buffer.
+
+    \c to_json can be called on any object \c __ngc_json_writer__ can
+    serialize, and on introspected objects in particular. The buffer can be
+    an object of any class that exposes an \c append(const \c char \c *,
+    \c size_t) method, e.g., \c std \c :: \c string.
+
+    \param that The object to serialize.
+    \param buffer The buffer to append to.
+
+    \author agent [agent@local]
+    \version 0.0.1
+    \date Oct 17, 2026
+  */
+  template <typename type, typename btype> inline void to_json(const type & that, btype & buffer);
+
+  /**
+    \fn to_json
+    \brief Returns the JSON serialization of an object.
+    \param that The object to serialize.
+    \return A \c std \c :: \c string containing the serialization.
+
+    \author agent [agent@local]
+    \version 0.0.1
+    \date Oct 17, 2026
+  */
+  template <typename type> inline std :: string to_json(const type & that);
+};
+
+#endif
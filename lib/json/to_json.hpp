@@ -0,0 +1,171 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+*/
+
+#ifndef __lib__json__to_json__hpp
+#define __lib__json__to_json__hpp
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+template <typename btype> inline void __ngc_json_writer__ :: string(btype & buffer, std :: string_view that)
+{
+  static const char hex[] = "0123456789abcdef";
+
+  buffer.append("\"", 1);
+
+  size_t run = 0;
+
+  for(size_t i = 0; i < that.size(); i++)
+  {
+    unsigned char c = that[i];
+
+    if(c >= 0x20 && c != '"' && c != '\\')
+      continue;
+
+    buffer.append(that.data() + run, i - run);
+    run = i + 1;
+
+    switch(c)
+    {
+      case '"': buffer.append("\\\"", 2); break;
+      case '\\': buffer.append("\\\\", 2); break;
+      case '\b': buffer.append("\\b", 2); break;
+      case '\f': buffer.append("\\f", 2); break;
+      case '\n': buffer.append("\\n", 2); break;
+      case '\r': buffer.append("\\r", 2); break;
+      case '\t': buffer.append("\\t", 2); break;
+      default:
+      {
+        char escaped[] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xf]};
+        buffer.append(escaped, sizeof(escaped));
+      }
+    }
+  }
+
+  buffer.append(that.data() + run, that.size() - run);
+  buffer.append("\"", 1);
+}
+
+template <size_t offset, typename btype, typename type> inline void __ngc_json_writer__ :: members(btype & buffer, const type & that)
+{
+  members <offset> (buffer, that, typename __ngc_make_index_pack__ <__ngc_base_count__ <type> :: value> :: type {}, typename __ngc_make_index_pack__ <__ngc_member_count__ <type> :: value> :: type {});
+}
+
+template <size_t offset, typename btype, typename type, size_t... bindexes, size_t... mindexes> inline void __ngc_json_writer__ :: members(btype & buffer, const type & that, __ngc_index_pack__ <bindexes...>, __ngc_index_pack__ <mindexes...>)
+{
+  (members <offset + fields <type> :: before(bindexes)> (buffer, (const typename type :: template __ngc_base__ <bindexes, false> :: type &) that), ...);
+
+  ((buffer.append(key <offset + fields <type> :: bases + mindexes == 0, typename type :: template __ngc_member__ <mindexes, false> :: name> :: value, key <offset + fields <type> :: bases + mindexes == 0, typename type :: template __ngc_member__ <mindexes, false> :: name> :: size), value(buffer, type :: template __ngc_member__ <mindexes, false> :: get(that))), ...);
+}
+
+template <typename btype, typename type> inline void __ngc_json_writer__ :: object(btype & buffer, const type & that)
+{
+  if constexpr(fields <type> :: value == 0)
+    buffer.append("{}", 2);
+  else
+  {
+    members <0> (buffer, that);
+    buffer.append("}", 1);
+  }
+}
+
+template <typename btype, typename type> inline void __ngc_json_writer__ :: value(btype & buffer, const type & that)
+{
+  if constexpr(is_optional <type> :: value)
+  {
+    if(that.__ngc_exists__)
+      value(buffer, that.__ngc_embody__());
+    else
+      buffer.append("null", 4);
+  }
+  else if constexpr(std :: is_same <type, bool> :: value)
+  {
+    if(that)
+      buffer.append("true", 4);
+    else
+      buffer.append("false", 5);
+  }
+  else if constexpr(std :: is_enum <type> :: value)
+    value(buffer, static_cast <typename std :: underlying_type <type> :: type> (that));
+  else if constexpr(std :: is_integral <type> :: value)
+  {
+    char digits[24];
+    buffer.append(digits, std :: to_chars(digits, digits + sizeof(digits), that).ptr - digits);
+  }
+  else if constexpr(std :: is_floating_point <type> :: value)
+  {
+    if(std :: isfinite(that))
+    {
+      char digits[32];
+      buffer.append(digits, std :: to_chars(digits, digits + sizeof(digits), that).ptr - digits);
+    }
+    else
+      buffer.append("null", 4);
+  }
+  else if constexpr(std :: is_same <type, std :: nullptr_t> :: value)
+    buffer.append("null", 4);
+  else if constexpr(std :: is_array <type> :: value && std :: is_same <typename std :: remove_cv <typename std :: remove_extent <type> :: type> :: type, char> :: value)
+  {
+    // A char array that is filled up has no terminator: read at most its extent.
+
+    const char * end = (const char *) std :: memchr(that, '\0', std :: extent <type> :: value);
+    string(buffer, std :: string_view(that, end ? end - that : std :: extent <type> :: value));
+  }
+  else if constexpr(std :: is_pointer <type> :: value && std :: is_same <typename std :: remove_cv <typename std :: remove_pointer <type> :: type> :: type, char> :: value)
+  {
+    // A null pointer has no characters to build a string_view on.
+
+    if(that)
+      string(buffer, that);
+    else
+      buffer.append("null", 4);
+  }
+  else if constexpr(std :: is_convertible <const type &, std :: string_view> :: value)
+    string(buffer, that);
+  else if constexpr(__ngc_is_introspected__ <type> :: value)
+    object(buffer, that);
+  else if constexpr(is_range <type> :: value)
+  {
+    buffer.append("[", 1);
+
+    bool first = true;
+
+    for(const auto & item : that)
+    {
+      if(!first)
+        buffer.append(",", 1);
+
+      first = false;
+      value(buffer, item);
+    }
+
+    buffer.append("]", 1);
+  }
+  else
+    static_assert(std :: is_void <type> :: value, "Type cannot be serialized to JSON.");
+}
+
+namespace ngc
+{
+  template <typename type, typename btype> inline void to_json(const type & that, btype & buffer)
+  {
+    __ngc_json_writer__ :: value(buffer, that);
+  }
+
+  template <typename type> inline std :: string to_json(const type & that)
+  {
+    std :: string buffer;
+    __ngc_json_writer__ :: value(buffer, that);
+    return buffer;
+  }
+};
+
+#endif
@@ -0,0 +1,274 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file __ngc_log__.h
+
+  This file includes the declaration of the \c __ngc_log__ service class, of
+  \c ngc \c :: \c log and of its public interface \c logger in namespace
+  \c ngc. Together, they implement a binary logger whose formatting is
+  deferred: logging an object only copies its bytes, and the object is
+  formatted to JSON later, away from the hot path.
+
+  \code
+  class request
+  {
+  public:
+    uint64_t time;
+    uint32_t client;
+    uint32_t status;
+  };
+
+  // After parser parses request ..
+
+  ngc :: log(request {now, client, 200}); // Copies 16 bytes and a type id.
+
+  // On a background thread ..
+
+  std :: string lines;
+  ngc :: logger :: drain(lines); // Appends {"time":...,"client":...,"status":200} and a new line.
+  \endcode
+
+  \see reference/log/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __lib__log____ngc_log____h
+#define __lib__log____ngc_log____h
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../json/to_json.h"
+
+#ifndef NGC_LOG_CAPACITY
+#define NGC_LOG_CAPACITY (1 << 20)
+#endif
+
+/**
+  \class __ngc_log__
+  \brief Service class that stores the logged objects of every thread.
+
+  Class \c __ngc_log__ keeps a \c ring of bytes for every thread that logs.
+  Logging an object appends to the \c ring of the calling thread a \c header
+  and a copy of the bytes of the object: no lock is taken, and nothing is
+  formatted. The \c header stores a pointer to the \c format function of the
+  type of the object, which serves as type id: the consumer calls it to
+  format the bytes that follow, using the member names and types of the
+  class, known at compile time.
+
+  Every \c ring is a single-producer, single-consumer queue: the owning thread
+  is its only producer, and the thread that calls \c ngc \c :: \c logger
+  \c :: \c drain, under the lock of the global \c registry, is its only
+  consumer.
+
+  \code
+  __ngc_log__ :: push(my_object); // Appends my_object to the ring of the calling thread.
+  \endcode
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+struct __ngc_log__
+{
+  static constexpr size_t capacity = NGC_LOG_CAPACITY; /**< The size in bytes of the \c ring of each thread. Must be a power of two. */
+  static constexpr size_t alignment = 8; /**< Every record in a \c ring starts at a multiple of \c alignment. */
+  static constexpr size_t max_size = 4096; /**< The maximum size of a logged object. */
+
+  static_assert((capacity & (capacity - 1)) == 0, "NGC_LOG_CAPACITY must be a power of two.");
+
+  typedef void (*formatter)(const char *, std :: string &); /**< A function that formats the bytes of a logged object, and appends them to a string. */
+
+  /**
+    \class header
+    \brief The header of a record in a \c ring, followed by the bytes of the
+    logged object.
+  */
+  struct header
+  {
+    formatter format; /**< The \c format function of the type of the logged object. */
+    size_t size; /**< The size of the logged object in bytes. */
+  };
+
+  /**
+    \class ring
+    \brief The thread-local queue of logged objects.
+
+    \c head and \c tail are byte counters that only grow, and are reduced
+    modulo \c capacity to index \c data. \c head is only written by the
+    owning thread, \c tail only by the consumer: they sit on separate cache
+    lines, and the producer keeps a private copy of \c tail that it only
+    refreshes when the \c ring looks full, so that logging does not touch the
+    cache line written by the consumer.
+
+    A \c ring registers itself in the \c registry upon construction. Upon
+    thread exit, the records still in the \c ring are formatted into the
+    \c registry, so that they are not lost when the thread terminates.
+  */
+  struct ring
+  {
+    alignas(64) std :: atomic <uint64_t> head {0}; /**< The number of bytes ever written. */
+    uint64_t cached {0}; /**< The value of \c tail last seen by the producer. */
+    std :: atomic <uint64_t> dropped {0}; /**< The number of objects that did not fit in the \c ring. */
+
+    alignas(64) std :: atomic <uint64_t> tail {0}; /**< The number of bytes ever read. */
+
+    char * data; /**< The \c capacity bytes of the \c ring. */
+
+    /**
+      \brief Constructs an empty \c ring and registers it in the \c registry.
+    */
+    ring();
+
+    /**
+      \brief Formats the records in the \c ring into the \c registry, then
+      unregisters it and deallocates its data.
+    */
+    ~ring();
+
+    /**
+      \brief Copies bytes into the \c ring, wrapping around its end.
+      \param position The byte counter to write at.
+      \param source The bytes to copy.
+      \param size The number of bytes to copy.
+    */
+    inline void write(uint64_t position, const void * source, size_t size);
+
+    /**
+      \brief Copies bytes from the \c ring, wrapping around its end.
+      \param position The byte counter to read at.
+      \param target The buffer to copy to.
+      \param size The number of bytes to copy.
+    */
+    inline void read(uint64_t position, void * target, size_t size) const;
+
+    /**
+      \brief Formats all the records in the \c ring, and consumes them. Only
+      the consumer can call \c drain.
+      \param buffer The string to append the formatted records to, one per
+      line.
+      \return The number of records formatted.
+    */
+    inline size_t drain(std :: string & buffer);
+  };
+
+  /**
+    \class registry
+    \brief The global, lock-protected store of thread rings.
+  */
+  struct registry
+  {
+    std :: mutex mutex; /**< Protects all the members of the \c registry, and serializes consumers. */
+
+    std :: vector <ring *> rings; /**< The rings of the running threads. */
+    std :: string retired; /**< The records formatted upon termination of their threads. */
+    size_t records = 0; /**< The number of records in \c retired. */
+    uint64_t dropped = 0; /**< The objects dropped by terminated threads. */
+  };
+
+  /**
+    \brief Returns the global \c registry.
+  */
+  static inline registry & global();
+
+  /**
+    \brief Returns the \c ring of the calling thread.
+  */
+  static inline ring & local();
+
+  /**
+    \brief Rounds a size up to a multiple of \c alignment.
+  */
+  static constexpr size_t align(size_t size);
+
+  /**
+    \brief Formats the bytes of a logged \c type object as JSON, and appends
+    them to a string.
+    \param type The type of the logged object.
+    \param bytes The bytes of the logged object.
+    \param buffer The string to append to.
+  */
+  template <typename type> static inline void format(const char * bytes, std :: string & buffer);
+
+  /**
+    \brief Appends an object to the \c ring of the calling thread.
+    \param that The object.
+    \return \c true if the object was appended, \c false if the \c ring was
+    full.
+  */
+  template <typename type> static inline bool push(const type & that);
+};
+
+namespace ngc
+{
+  /**
+    \fn log
+    \brief Logs an object, whose formatting is deferred to
+    \c ngc \c :: \c logger \c :: \c drain.
+
+    Only trivially copyable objects that \c ngc \c :: \c to_json can
+    serialize can be logged: their bytes are copied as they are, and must
+    still represent the same value when they are formatted. In particular,
+    \c const \c char \c * members are followed when the object is
+    formatted, and must point to strings that are never deallocated (e.g.,
+    string literals).
+
+    \param that The object to log.
+    \return \c true if the object was logged, \c false if the ring of the
+    calling thread was full, in which case the object is dropped.
+
+    \author agent [agent@local]
+    \version 0.0.1
+    \date Oct 17, 2026
+  */
+  template <typename type> inline bool log(const type & that);
+
+  /**
+    \class logger
+    \brief Public interface to the consumer side of the logger.
+
+    \author agent [agent@local]
+    \version 0.0.1
+    \date Oct 17, 2026
+  */
+  struct logger
+  {
+    /**
+      \brief Formats as JSON the objects logged by all threads since the last
+      call, and appends them to a string, one per line.
+
+      The objects logged by each thread are appended in the order they were
+      logged. No order is defined among objects logged by different threads.
+      This takes the lock of the registry, but does not stop any thread from
+      logging: objects logged while \c drain runs may or may not be included.
+
+      \param buffer The string to append to.
+      \return The number of objects appended.
+    */
+    static inline size_t drain(std :: string & buffer);
+
+    /**
+      \brief Returns the number of objects dropped so far by all threads
+      because their ring was full.
+    */
+    static inline uint64_t dropped();
+  };
+};
+
+#endif
@@ -0,0 +1,192 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+*/
+
+#ifndef __lib__log____ngc_log____hpp
+#define __lib__log____ngc_log____hpp
+
+#include <cstring>
+#include <new>
+
+inline __ngc_log__ :: ring :: ring()
+{
+  this->data = new char[capacity];
+
+  registry & global = __ngc_log__ :: global();
+  std :: lock_guard <std :: mutex> lock(global.mutex);
+
+  global.rings.push_back(this);
+}
+
+inline __ngc_log__ :: ring :: ~ring()
+{
+  registry & global = __ngc_log__ :: global();
+  std :: lock_guard <std :: mutex> lock(global.mutex);
+
+  global.records += this->drain(global.retired);
+  global.dropped += this->dropped.load(std :: memory_order_relaxed);
+
+  for(size_t i = 0; i < global.rings.size(); i++)
+    if(global.rings[i] == this)
+    {
+      global.rings.erase(global.rings.begin() + i);
+      break;
+    }
+
+  delete [] this->data;
+}
+
+inline void __ngc_log__ :: ring :: write(uint64_t position, const void * source, size_t size)
+{
+  size_t offset = position & (capacity - 1);
+
+  if(offset + size <= capacity)
+    std :: memcpy(this->data + offset, source, size);
+  else
+  {
+    std :: memcpy(this->data + offset, source, capacity - offset);
+    std :: memcpy(this->data, (const char *) source + (capacity - offset), size - (capacity - offset));
+  }
+}
+
+inline void __ngc_log__ :: ring :: read(uint64_t position, void * target, size_t size) const
+{
+  size_t offset = position & (capacity - 1);
+
+  if(offset + size <= capacity)
+    std :: memcpy(target, this->data + offset, size);
+  else
+  {
+    std :: memcpy(target, this->data + offset, capacity - offset);
+    std :: memcpy((char *) target + (capacity - offset), this->data, size - (capacity - offset));
+  }
+}
+
+inline size_t __ngc_log__ :: ring :: drain(std :: string & buffer)
+{
+  alignas(alignof(std :: max_align_t)) char bytes[max_size];
+
+  uint64_t tail = this->tail.load(std :: memory_order_relaxed);
+  uint64_t head = this->head.load(std :: memory_order_acquire);
+
+  size_t records = 0;
+
+  while(tail != head)
+  {
+    header record;
+
+    this->read(tail, &record, sizeof(header));
+    this->read(tail + sizeof(header), bytes, record.size);
+
+    tail += sizeof(header) + align(record.size);
+    this->tail.store(tail, std :: memory_order_release);
+
+    record.format(bytes, buffer);
+    buffer += '\n';
+
+    records++;
+  }
+
+  return records;
+}
+
+inline __ngc_log__ :: registry & __ngc_log__ :: global()
+{
+  static registry instance;
+  return instance;
+}
+
+inline __ngc_log__ :: ring & __ngc_log__ :: local()
+{
+  static thread_local ring instance;
+  return instance;
+}
+
+constexpr size_t __ngc_log__ :: align(size_t size)
+{
+  return (size + alignment - 1) & ~(alignment - 1);
+}
+
+template <typename type> inline void __ngc_log__ :: format(const char * bytes, std :: string & buffer)
+{
+  alignas(type) char storage[sizeof(type)];
+  std :: memcpy(storage, bytes, sizeof(type));
+
+  ngc :: to_json(* std :: launder(reinterpret_cast <const type *> (storage)), buffer);
+}
+
+template <typename type> inline bool __ngc_log__ :: push(const type & that)
+{
+  static_assert(std :: is_trivially_copyable <type> :: value, "Only trivially copyable objects can be logged.");
+  static_assert(sizeof(type) <= max_size, "Object is too large to be logged.");
+
+  constexpr size_t size = sizeof(header) + align(sizeof(type));
+
+  ring & local = __ngc_log__ :: local();
+  uint64_t head = local.head.load(std :: memory_order_relaxed);
+
+  if(head + size - local.cached > capacity)
+  {
+    local.cached = local.tail.load(std :: memory_order_acquire);
+
+    if(head + size - local.cached > capacity)
+    {
+      local.dropped.store(local.dropped.load(std :: memory_order_relaxed) + 1, std :: memory_order_relaxed);
+      return false;
+    }
+  }
+
+  header record = {&format <type>, sizeof(type)};
+
+  local.write(head, &record, sizeof(header));
+  local.write(head + sizeof(header), &that, sizeof(type));
+
+  local.head.store(head + size, std :: memory_order_release);
+  return true;
+}
+
+namespace ngc
+{
+  template <typename type> inline bool log(const type & that)
+  {
+    return __ngc_log__ :: push(that);
+  }
+
+  inline size_t logger :: drain(std :: string & buffer)
+  {
+    __ngc_log__ :: registry & global = __ngc_log__ :: global();
+    std :: lock_guard <std :: mutex> lock(global.mutex);
+
+    size_t records = global.records;
+
+    buffer += global.retired;
+    global.retired.clear();
+    global.records = 0;
+
+    for(__ngc_log__ :: ring * local : global.rings)
+      records += local->drain(buffer);
+
+    return records;
+  }
+
+  inline uint64_t logger :: dropped()
+  {
+    __ngc_log__ :: registry & global = __ngc_log__ :: global();
+    std :: lock_guard <std :: mutex> lock(global.mutex);
+
+    uint64_t dropped = global.dropped;
+
+    for(__ngc_log__ :: ring * local : global.rings)
+      dropped += local->dropped.load(std :: memory_order_relaxed);
+
+    return dropped;
+  }
+};
+
+#endif
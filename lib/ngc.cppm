@@ -0,0 +1,86 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file ngc.cppm
+
+  This file is the interface of the \c ngc C++ 20 named module. Importing the
+  module makes available the same entities as including \c ngc.h, without
+  parsing the library in every translation unit:
+
+  \code
+  import ngc;
+  \endcode
+
+  The module is experimental, and only exports the core library: the
+  features that have their own entry points in \c lib/ngc (e.g.,
+  \c ngc/json.h) are not part of it.
+
+  The module is built by including \c ngc.h in its purview, in an
+  \c extern \c "C++" block, so that the library entities are meant to stay
+  attached to the global module and to be the same entities whether they are
+  imported or included (GCC 12 still attaches them to the module, see the
+  reference). All the standard headers the core library needs are included
+  in the global module fragment first, so that their include guards keep them
+  out of the purview. The core library only uses type traits and
+  \c std \c :: \c forward from them, since with GCC 12 other standard
+  templates used in the purview conflict with the standard headers included
+  after the import.
+
+  Since macros are not exported by modules, the configuration of the library
+  (e.g., \c NGC_INSTRUMENT or \c NDEBUG) is the one the module was built
+  with, regardless of the macros defined by the translation units that import
+  it.
+
+  Parsed code that specializes \c __ngc_optional__ also needs
+  \c std \c :: \c conditional and the other standard type traits used by the
+  parser: it should either import \c std or include \c <type_traits> itself.
+
+  \see reference/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+module;
+
+/* Standard headers */
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#ifdef NGC_INSTRUMENT
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+#endif
+
+export module ngc;
+
+/* Library */
+
+export extern "C++"
+{
+#include "ngc.h"
+}
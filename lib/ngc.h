@@ -19,6 +19,17 @@
   points are included from here, that include other files. All the files are
   directly included from here.
 
+  Translation units that only use some of the functionalities can include the
+  partial entry points in \c lib/ngc instead: \c ngc/string.h,
+  \c ngc/parameter_pack.h, \c ngc/introspection.h and \c ngc/optional.h.
+  Every header in the library is self-contained, so that any combination of
+  entry points can be included, in any order.
+
+  The JSON serialization, the logger, the structures of arrays and the sorting
+  of records are not part of the core library, and are not included from
+  here: they are only available through their own entry points,
+  \c ngc/json.h, \c ngc/log.h, \c ngc/query.h and \c ngc/sort.h.
+
   \author Matteo Monti [matteo.monti@rain.vg]
   \version 0.0.1
   \date Jul 07, 2016
@@ -33,6 +44,7 @@
 
 #include "introspection/__ngc_member_count__.h"
 #include "introspection/__ngc_base_count__.h"
+#include "introspection/__ngc_is_introspected__.h"
 
 #include "optional/__ngc_null__.h"
 #include "optional/__ngc_optional__.h"
@@ -46,8 +58,14 @@
 #include "optional/__ngc_phantom__/__ngc_embody__.h"
 #include "optional/__ngc_phantom__/__ngc_phantom_base__.h"
 
+#include "optional/__ngc_unwrap__.h"
+
 #include "string/string.h"
 
+#ifdef NGC_INSTRUMENT
+#include "instrument/__ngc_instrument__.h"
+#endif
+
 /* Implementations */
 
 #include "optional/__ngc_factory__/__ngc_constructor__.hpp"
@@ -57,6 +75,12 @@
 #include "optional/__ngc_phantom__/__ngc_embody__.hpp"
 #include "optional/__ngc_phantom__/__ngc_phantom_base__.hpp"
 
+#include "optional/__ngc_unwrap__.hpp"
+
 #include "string/string.hpp"
 
+#ifdef NGC_INSTRUMENT
+#include "instrument/__ngc_instrument__.hpp"
+#endif
+
 #endif
@@ -0,0 +1,45 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file introspection.h
+
+  This file serves as entry point for the introspection utilities of the ngc
+  core library. Include this file in translation units that introspect classes,
+  but do not use optionals or constructor mirroring. Since member names are
+  \c ngc \c :: \c string types, strings are included as well.
+
+  The inclusion process is not recursive, i.e., no other partial inclusion entry
+  points are included from here. All the files are directly included from here.
+
+  \see lib/ngc.h
+  \see reference/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __lib__ngc__introspection__h
+#define __lib__ngc__introspection__h
+
+/* Headers */
+
+#include "../introspection/__ngc_member_count__.h"
+#include "../introspection/__ngc_base_count__.h"
+#include "../introspection/__ngc_is_introspected__.h"
+
+#include "../string/string.h"
+
+/* Implementations */
+
+#include "../string/string.hpp"
+
+#endif
@@ -0,0 +1,54 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file json.h
+
+  This file serves as entry point for the JSON serialization and
+  deserialization of introspected objects. Since both iterate on the members
+  of introspected classes, introspection and strings are included as well,
+  together with the declaration of \c __ngc_optional__ and \c __ngc_default__,
+  used to engage optional members.
+
+  The inclusion process is not recursive, i.e., no other partial inclusion entry
+  points are included from here. All the files are directly included from here.
+
+  \see lib/ngc.h
+  \see reference/json/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __lib__ngc__json__h
+#define __lib__ngc__json__h
+
+/* Headers */
+
+#include "../introspection/__ngc_member_count__.h"
+#include "../introspection/__ngc_base_count__.h"
+#include "../introspection/__ngc_is_introspected__.h"
+
+#include "../optional/__ngc_optional__.h"
+
+#include "../string/string.h"
+
+#include "../json/to_json.h"
+#include "../json/from_json.h"
+
+/* Implementations */
+
+#include "../string/string.hpp"
+
+#include "../json/to_json.hpp"
+#include "../json/from_json.hpp"
+
+#endif
@@ -0,0 +1,52 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file log.h
+
+  This file serves as entry point for the deferred-format binary logger.
+  Since logged objects are formatted with \c ngc \c :: \c to_json,
+  introspection, strings and JSON serialization are included as well.
+
+  The inclusion process is not recursive, i.e., no other partial inclusion entry
+  points are included from here. All the files are directly included from here.
+
+  \see lib/ngc.h
+  \see reference/log/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __lib__ngc__log__h
+#define __lib__ngc__log__h
+
+/* Headers */
+
+#include "../introspection/__ngc_member_count__.h"
+#include "../introspection/__ngc_base_count__.h"
+#include "../introspection/__ngc_is_introspected__.h"
+
+#include "../string/string.h"
+
+#include "../json/to_json.h"
+
+#include "../log/__ngc_log__.h"
+
+/* Implementations */
+
+#include "../string/string.hpp"
+
+#include "../json/to_json.hpp"
+
+#include "../log/__ngc_log__.hpp"
+
+#endif
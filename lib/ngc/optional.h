@@ -0,0 +1,80 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file optional.h
+
+  This file serves as entry point for the optionals of the ngc core library,
+  i.e., the phantoms and the factory that constructs, initializes and destructs
+  objects. Include this file in translation units that use optionals or
+  mirrored constructors. The factory iterates on the members of introspected
+  classes, so introspection, strings and parameter packs are included as
+  well.
+
+  The inclusion process is not recursive, i.e., no other partial inclusion entry
+  points are included from here. All the files are directly included from here.
+
+  \see lib/ngc.h
+  \see reference/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __lib__ngc__optional__h
+#define __lib__ngc__optional__h
+
+/* Headers */
+
+#include "../__ngc_parameter_pack__.h"
+
+#include "../introspection/__ngc_member_count__.h"
+#include "../introspection/__ngc_base_count__.h"
+#include "../introspection/__ngc_is_introspected__.h"
+
+#include "../optional/__ngc_null__.h"
+#include "../optional/__ngc_optional__.h"
+
+#include "../optional/__ngc_factory__/__ngc_array_traits__.h"
+#include "../optional/__ngc_factory__/__ngc_type_probe__.h"
+#include "../optional/__ngc_factory__/__ngc_constructor__.h"
+#include "../optional/__ngc_factory__/__ngc_destructor__.h"
+#include "../optional/__ngc_factory__/__ngc_initializer__.h"
+
+#include "../optional/__ngc_phantom__/__ngc_embody__.h"
+#include "../optional/__ngc_phantom__/__ngc_phantom_base__.h"
+
+#include "../optional/__ngc_unwrap__.h"
+
+#include "../string/string.h"
+
+#ifdef NGC_INSTRUMENT
+#include "../instrument/__ngc_instrument__.h"
+#endif
+
+/* Implementations */
+
+#include "../optional/__ngc_factory__/__ngc_constructor__.hpp"
+#include "../optional/__ngc_factory__/__ngc_destructor__.hpp"
+#include "../optional/__ngc_factory__/__ngc_initializer__.hpp"
+
+#include "../optional/__ngc_phantom__/__ngc_embody__.hpp"
+#include "../optional/__ngc_phantom__/__ngc_phantom_base__.hpp"
+
+#include "../optional/__ngc_unwrap__.hpp"
+
+#include "../string/string.hpp"
+
+#ifdef NGC_INSTRUMENT
+#include "../instrument/__ngc_instrument__.hpp"
+#endif
+
+#endif
@@ -0,0 +1,35 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file parameter_pack.h
+
+  This file serves as entry point for the parameter pack utilities of the ngc
+  core library.
+
+  The inclusion process is not recursive, i.e., no other partial inclusion entry
+  points are included from here. All the files are directly included from here.
+
+  \see lib/ngc.h
+  \see reference/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __lib__ngc__parameter_pack__h
+#define __lib__ngc__parameter_pack__h
+
+/* Headers */
+
+#include "../__ngc_parameter_pack__.h"
+
+#endif
@@ -0,0 +1,49 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file query.h
+
+  This file serves as entry point for structures of arrays and their
+  queries. Since columns are named after the members of introspected classes,
+  introspection and strings are included as well.
+
+  The inclusion process is not recursive, i.e., no other partial inclusion entry
+  points are included from here. All the files are directly included from here.
+
+  \see lib/ngc.h
+  \see reference/query/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __lib__ngc__query__h
+#define __lib__ngc__query__h
+
+/* Headers */
+
+#include "../introspection/__ngc_member_count__.h"
+#include "../introspection/__ngc_base_count__.h"
+#include "../introspection/__ngc_member_index__.h"
+#include "../introspection/__ngc_is_introspected__.h"
+
+#include "../string/string.h"
+
+#include "../query/query.h"
+
+/* Implementations */
+
+#include "../string/string.hpp"
+
+#include "../query/query.hpp"
+
+#endif
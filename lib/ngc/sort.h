@@ -0,0 +1,49 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file sort.h
+
+  This file serves as entry point for sorting and indexing records by the
+  value of one of their members. Since keys are named after the members of
+  introspected classes, introspection and strings are included as well.
+
+  The inclusion process is not recursive, i.e., no other partial inclusion entry
+  points are included from here. All the files are directly included from here.
+
+  \see lib/ngc.h
+  \see reference/sort/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __lib__ngc__sort__h
+#define __lib__ngc__sort__h
+
+/* Headers */
+
+#include "../introspection/__ngc_member_count__.h"
+#include "../introspection/__ngc_base_count__.h"
+#include "../introspection/__ngc_member_index__.h"
+#include "../introspection/__ngc_is_introspected__.h"
+
+#include "../string/string.h"
+
+#include "../sort/sort_by.h"
+
+/* Implementations */
+
+#include "../string/string.hpp"
+
+#include "../sort/sort_by.hpp"
+
+#endif
@@ -0,0 +1,40 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file string.h
+
+  This file serves as entry point for the \c ngc \c :: \c string compile-time
+  strings of the ngc core library. Include this file in translation units that
+  only use backtick strings.
+
+  The inclusion process is not recursive, i.e., no other partial inclusion entry
+  points are included from here. All the files are directly included from here.
+
+  \see lib/ngc.h
+  \see reference/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __lib__ngc__string__h
+#define __lib__ngc__string__h
+
+/* Headers */
+
+#include "../string/string.h"
+
+/* Implementations */
+
+#include "../string/string.hpp"
+
+#endif
@@ -34,9 +34,16 @@
 #ifndef __lib__optional____ngc_factory______ngc_constructor____h
 #define __lib__optional____ngc_factory______ngc_constructor____h
 
+#include <cstddef>
+#include <new>
 #include <type_traits>
+#include <utility>
 
 #include "__ngc_array_traits__.h"
+#include "../../__ngc_parameter_pack__.h"
+#include "../../introspection/__ngc_member_count__.h"
+#include "../../introspection/__ngc_base_count__.h"
+#include "../../introspection/__ngc_is_introspected__.h"
 
 /**
   \class __ngc_constructor__
@@ -189,7 +196,20 @@ template <> struct __ngc_constructor__ <false, true>
     so as to initialize all its members with default calls to
     \c __ngc_construct__.
   */
-  template <typename type, typename std :: enable_if <std :: is_default_constructible <type> :: value && !(is_ngc_default_constructible <type> :: value)> :: type * = nullptr> static inline void execute(type & that);
+  template <typename type, typename std :: enable_if <std :: is_default_constructible <type> :: value && !(is_ngc_default_constructible <type> :: value) && __ngc_is_introspected__ <type> :: value> :: type * = nullptr> static inline void execute(type & that);
+
+  /**
+    \brief Proxy for the default constructor of an object that is default
+    constructible, but was not introspected by the parser.
+
+    This method will only accept object classes whose members cannot be
+    iterated on (see \c __ngc_is_introspected__), and that therefore cannot
+    be implicitly initialized by \c __ngc_initialize__.
+
+    This method will default construct the object in place by calling its
+    actual default constructor.
+  */
+  template <typename type, typename std :: enable_if <std :: is_default_constructible <type> :: value && !(is_ngc_default_constructible <type> :: value) && !(__ngc_is_introspected__ <type> :: value)> :: type * = nullptr> static inline void execute(type & that);
 
   /**
     \class is_ngc_copy_constructible
@@ -220,64 +240,64 @@ template <> struct __ngc_constructor__ <false, true>
   };
 
   /**
-    \class copy_initializer
-    \brief Iterator to recursively build a call to \c __ngc_initialize__ with
-    all the members in an object to be implicitly copied.
+    \class is_trivial_copy
+    \brief Determines if the implicit copy of a class can be carried out by its
+    actual, trivial copy constructor.
 
-    \c copy_initializer serves as an iterator to recursively build a call to
-    \c __ngc_initialize__ with all the members in an object. It is used when
-    making implicit copy construction (see later), where every member of the
-    object to be constructed is initialized with the corresponding member in the
-    object to be copied.
+    The copy constructor of a trivially copy constructible class copies its
+    bytes, which is what an implicit copy through \c copy_initializer does one
+    member at a time. Copying the whole object at once lets the compiler merge
+    the copies of adjacent members. When \c NGC_INSTRUMENT is defined, the
+    members are still copied one at a time, so that their construction is
+    recorded.
 
-    \param index The index of the iteration.
-    \param dummy Dummy boolean value.
+    \param type The type to test
 
-    \author Matteo Monti [matteo.monti@rain.vg], Luca Grementieri [luca.grementieri@rain.vg]
+    \author agent [agent@local]
     \version 0.0.1
-    \date Jul 19, 2016
+    \date Oct 17, 2026
   */
-  template <size_t index, bool dummy> struct copy_initializer;
-
-  template <bool dummy> struct copy_initializer <0, dummy>
+  template <typename type> struct is_trivial_copy
   {
-    /**
-      \brief Last iteration of initialization loop, forwards to
-      \c __ngc_initialize__ all the members in the object to construct.
+#ifdef NGC_INSTRUMENT
+    static constexpr bool value = false; /**< Always \c false, so that members are recorded when copied. */
+#else
+    static constexpr bool value = std :: is_trivially_copy_constructible <type> :: value; /**< \c true if a \c type object can be copied by copying its bytes, \c false otherwise. */
+#endif
+  };
 
-      Iteration works as a proxy for implicit copy construction of an object
-      that is copy constructible, but has no explicit copy \c __ngc_construct__
-      method specified.
+  /**
+    \class copy_initializer
+    \brief Initializes every member of an object to be implicitly copied with
+    the corresponding member of another object.
 
-      This method initializes the object \c with \c arguments, whose values
-      result from the iteration of \copy_initializer on the members of \other.
+    \c copy_initializer is used when making implicit copy construction (see
+    later): as \c __ngc_initialize__ would do if provided with the name and the
+    value of every member of the object to be copied, it default constructs
+    the base classes of the object, then copy constructs each of its members
+    from the corresponding member of the object to be copied.
 
-      \param that The object to construct.
-      \param other The object to be copied on \c that.
-      \param arguments... The arguments to the initialization of \c that.
-    */
-    template <typename type, typename otype, typename... atypes, typename std :: enable_if <std :: is_same <typename std :: remove_const <typename std :: remove_reference <otype> :: type> :: type, type> :: value> :: type * = nullptr> static inline void execute(type & that, otype && other, atypes && ... arguments);
-  };
+    The base classes and the members are iterated on with a pack expansion on
+    the indexes in \c __ngc_index_pack__ parameters, rather than with a
+    recursion, so that the depth of the instantiation does not grow with the
+    number of members.
 
-  template <size_t index, bool dummy> struct copy_initializer
+    \author Matteo Monti [matteo.monti@rain.vg], Luca Grementieri [luca.grementieri@rain.vg], agent [agent@local]
+    \version 0.0.1
+    \date Jul 19, 2016
+  */
+  struct copy_initializer
   {
     /**
-      \brief Recursively builds a call to \c __ngc_initialize__ on an object
-      with all the member names and values in another object.
-
-      It is used for implicit copy construction (i.e., when all members of an
-      object need to be initialized with the corresponding members of another
-      object).
-
-      This method forwards the parameters \c arguments and the name and the
-      value of the member in position \c index of \other to the next
-      \c copy_initializer.
+      \brief Default constructs the base classes at \c bindexes of \c that,
+      then copy constructs its members at \c mindexes from those of \c other.
 
       \param that The object to construct.
       \param other The object to be copied on \c that.
-      \param arguments... The arguments to the initialization of \c that.
+      \param bases An \c __ngc_index_pack__ with the indexes of the base classes of \c that.
+      \param members An \c __ngc_index_pack__ with the indexes of the members of \c that.
     */
-    template <typename type, typename otype, typename... atypes, typename std :: enable_if <std :: is_same <typename std :: remove_const <typename std :: remove_reference <otype> :: type> :: type, type> :: value> :: type * = nullptr> static inline void execute(type & that, otype && other, atypes && ... arguments);
+    template <typename type, typename otype, size_t... bindexes, size_t... mindexes> static inline void execute(type & that, otype && other, __ngc_index_pack__ <bindexes...> bases, __ngc_index_pack__ <mindexes...> members);
   };
 
   /**
@@ -307,7 +327,20 @@ template <> struct __ngc_constructor__ <false, true>
     \param that The object to construct.
     \param other The object to be copied on \c that.
   */
-  template <typename type, typename otype, typename std :: enable_if <std :: is_same <typename std :: remove_const <typename std :: remove_reference <otype> :: type> :: type, type> :: value && std :: is_copy_constructible <type> :: value && !(is_ngc_copy_constructible <type> :: value)> :: type * = nullptr> static inline void execute(type & that, otype && other);
+  template <typename type, typename otype, typename std :: enable_if <std :: is_same <typename std :: remove_const <typename std :: remove_reference <otype> :: type> :: type, type> :: value && std :: is_copy_constructible <type> :: value && !(is_ngc_copy_constructible <type> :: value) && __ngc_is_introspected__ <type> :: value && !(is_trivial_copy <type> :: value)> :: type * = nullptr> static inline void execute(type & that, otype && other);
+
+  /**
+    \brief Proxy for the copy constructor of an object that is copy
+    constructible, but was not introspected by the parser, or whose copy
+    constructor is trivial (see \c is_trivial_copy).
+
+    This method will copy construct the object in place by calling its actual
+    copy (or move) constructor.
+
+    \param that The object to construct.
+    \param other The object to be copied on \c that.
+  */
+  template <typename type, typename otype, typename std :: enable_if <std :: is_same <typename std :: remove_const <typename std :: remove_reference <otype> :: type> :: type, type> :: value && std :: is_copy_constructible <type> :: value && !(is_ngc_copy_constructible <type> :: value) && (!(__ngc_is_introspected__ <type> :: value) || is_trivial_copy <type> :: value)> :: type * = nullptr> static inline void execute(type & that, otype && other);
 
   /**
     \brief Proxy for parametric \c __ngc_construct__ method on an object,
@@ -321,20 +354,39 @@ template <> struct __ngc_constructor__ <false, true>
     \param argument The first argument (mandatory).
     \param arguments... The remaining arguments to its constructor.
   */
-  template <typename type, typename atype, typename... atypes, typename std :: enable_if <!(std :: is_same <typename std :: remove_const <typename std :: remove_reference <atype> :: type> :: type, type> :: value)> :: type * = nullptr> static inline void execute(type & that, atype && argument, atypes && ... arguments);
+  template <typename type, typename atype, typename... atypes, typename std :: enable_if <!(std :: is_same <typename std :: remove_const <typename std :: remove_reference <atype> :: type> :: type, type> :: value) && __ngc_is_introspected__ <type> :: value> :: type * = nullptr> static inline void execute(type & that, atype && argument, atypes && ... arguments);
+
+  /**
+    \brief Proxy for a parametric constructor of an object that was not
+    introspected by the parser, constructs the object with the arguments
+    provided.
+
+    Objects that were not introspected do not expose parametric
+    \c __ngc_construct__ methods. This method constructs the object in place
+    by calling its actual constructor.
+
+    \param that The object to construct.
+    \param argument The first argument (mandatory).
+    \param arguments... The remaining arguments to its constructor.
+  */
+  template <typename type, typename atype, typename... atypes, typename std :: enable_if <!(std :: is_same <typename std :: remove_const <typename std :: remove_reference <atype> :: type> :: type, type> :: value) && !(__ngc_is_introspected__ <type> :: value)> :: type * = nullptr> static inline void execute(type & that, atype && argument, atypes && ... arguments);
 };
 
 template <bool is_class> struct __ngc_constructor__ <true, is_class>
 {
   /**
     \class iterator
-    \brief Iterator over the array items, calls \c __ngc_constructor__ \c ::
-    \c execute on every element in the array.
+    \brief Iterator over the array items, calls \c __ngc_construct__ on every
+    element in the array.
 
     Class \c iterator is a nested service class for \c __ngc_constructor__. It
     serves the purpose to sequentially initialize all the elements of an array,
-    by iteratively calling \c __ngc_constructor__ \c :: \c execute on every
-    element in the array.
+    by iteratively calling \c __ngc_construct__ on every element in the array.
+    Going through \c __ngc_construct__ rather than \c __ngc_constructor__
+    \c :: \c execute dispatches on the type of each element, so that arrays
+    of arrays are constructed element by element, and the construction of each
+    element is recorded when \c NGC_INSTRUMENT is defined, as its destruction
+    is by \c __ngc_destruct__.
 
     \c iterator \c :: \c execute will accept:
      * just the array to construct, in that case it will iterate on the default
@@ -344,8 +396,8 @@ template <bool is_class> struct __ngc_constructor__ <true, is_class>
      sequentially using each term in the initialization list as parameter for
      the constructor of each term in the array, or
      * another array of the same type, in that case the \c iterator will
-     sequentially call a copy \c __ngc_constructor__ \c :: \c execute on every
-     corresponding element in the arrays.
+     sequentially call a copy \c __ngc_construct__ on every corresponding
+     element in the arrays.
 
     Note that the iteration is implemented with the indexes in reverse order,
     so that \c __iterator__ \c <0> will construct the last element of the array,
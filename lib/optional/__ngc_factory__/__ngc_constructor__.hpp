@@ -11,7 +11,7 @@
 #ifndef __lib__optional____ngc_factory______ngc_constructor____hpp
 #define __lib__optional____ngc_factory______ngc_constructor____hpp
 
-template <typename type> inline void __ngc_constructor__ <false, false> :: execute(type & that)
+template <typename type> inline void __ngc_constructor__ <false, false> :: execute(type &)
 {
 }
 
@@ -25,19 +25,24 @@ template <typename type, typename std :: enable_if <__ngc_constructor__ <false,
   that.__ngc_construct__();
 }
 
-template <typename type, typename std :: enable_if <std :: is_default_constructible <type> :: value && !(__ngc_constructor__ <false, true> :: is_ngc_default_constructible <type> :: value)> :: type *> inline void __ngc_constructor__ <false, true> :: execute(type & that)
+template <typename type, typename std :: enable_if <std :: is_default_constructible <type> :: value && !(__ngc_constructor__ <false, true> :: is_ngc_default_constructible <type> :: value) && __ngc_is_introspected__ <type> :: value> :: type *> inline void __ngc_constructor__ <false, true> :: execute(type & that)
 {
   __ngc_initialize__(that);
 }
 
-template <bool dummy> template <typename type, typename otype, typename... atypes, typename std :: enable_if <std :: is_same <typename std :: remove_const <typename std :: remove_reference <otype> :: type> :: type, type> :: value> :: type *> inline void __ngc_constructor__ <false, true> :: copy_initializer <0, dummy> :: execute(type & that, otype && other, atypes && ... arguments)
+template <typename type, typename std :: enable_if <std :: is_default_constructible <type> :: value && !(__ngc_constructor__ <false, true> :: is_ngc_default_constructible <type> :: value) && !(__ngc_is_introspected__ <type> :: value)> :: type *> inline void __ngc_constructor__ <false, true> :: execute(type & that)
 {
-  __ngc_initialize__(that, std :: forward <atypes> (arguments)..., typename type :: template __ngc_member__ <0, false> :: name {}, type :: template __ngc_member__ <0, false> :: get(other));
+  new (&that) type;
 }
 
-template <size_t index, bool dummy> template <typename type, typename otype, typename... atypes, typename std :: enable_if <std :: is_same <typename std :: remove_const <typename std :: remove_reference <otype> :: type> :: type, type> :: value> :: type *> inline void __ngc_constructor__ <false, true> :: copy_initializer <index, dummy> :: execute(type & that, otype && other, atypes && ... arguments)
+template <typename type, typename otype, size_t... bindexes, size_t... mindexes> inline void __ngc_constructor__ <false, true> :: copy_initializer :: execute(type & that, otype && other, __ngc_index_pack__ <bindexes...>, __ngc_index_pack__ <mindexes...>)
 {
-  copy_initializer <index - 1, false> :: execute(that, std :: forward <otype> (other), std :: forward <atypes> (arguments)..., typename type :: template __ngc_member__ <index, false> :: name {}, type :: template __ngc_member__ <index, false> :: get(other));
+#ifdef NGC_INSTRUMENT
+  __ngc_instrument__ :: record <type> (__ngc_instrument__ :: initialize, &that);
+#endif
+
+  (__ngc_construct__((typename type :: template __ngc_base__ <bindexes, false> :: type &) that), ...);
+  (__ngc_construct__(type :: template __ngc_member__ <mindexes, false> :: get(that), type :: template __ngc_member__ <mindexes, false> :: get(other)), ...);
 }
 
 template <typename type, typename otype, typename std :: enable_if <std :: is_same <typename std :: remove_const <typename std :: remove_reference <otype> :: type> :: type, type> :: value && __ngc_constructor__ <false, true> :: is_ngc_copy_constructible <type> :: value> :: type *> inline void __ngc_constructor__ <false, true> :: execute(type & that, otype && other)
@@ -45,56 +50,70 @@ template <typename type, typename otype, typename std :: enable_if <std :: is_sa
   that.__ngc_construct__(std :: forward <otype> (other));
 }
 
-template <typename type, typename otype, typename std :: enable_if <std :: is_same <typename std :: remove_const <typename std :: remove_reference <otype> :: type> :: type, type> :: value && std :: is_copy_constructible <type> :: value && !(__ngc_constructor__ <false, true> :: is_ngc_copy_constructible <type> :: value)> :: type *> inline void __ngc_constructor__ <false, true> :: execute(type & that, otype && other)
+template <typename type, typename otype, typename std :: enable_if <std :: is_same <typename std :: remove_const <typename std :: remove_reference <otype> :: type> :: type, type> :: value && std :: is_copy_constructible <type> :: value && !(__ngc_constructor__ <false, true> :: is_ngc_copy_constructible <type> :: value) && __ngc_is_introspected__ <type> :: value && !(__ngc_constructor__ <false, true> :: is_trivial_copy <type> :: value)> :: type *> inline void __ngc_constructor__ <false, true> :: execute(type & that, otype && other)
+{
+  copy_initializer :: execute(that, std :: forward <otype> (other), typename __ngc_make_index_pack__ <__ngc_base_count__ <type> :: value> :: type {}, typename __ngc_make_index_pack__ <__ngc_member_count__ <type> :: value> :: type {});
+}
+
+template <typename type, typename otype, typename std :: enable_if <std :: is_same <typename std :: remove_const <typename std :: remove_reference <otype> :: type> :: type, type> :: value && std :: is_copy_constructible <type> :: value && !(__ngc_constructor__ <false, true> :: is_ngc_copy_constructible <type> :: value) && (!(__ngc_is_introspected__ <type> :: value) || __ngc_constructor__ <false, true> :: is_trivial_copy <type> :: value)> :: type *> inline void __ngc_constructor__ <false, true> :: execute(type & that, otype && other)
 {
-	copy_initializer <__ngc_member_count__ <type> :: value - 1, false> :: execute(that, std :: forward <otype> (other));
+  new (&that) type(std :: forward <otype> (other));
 }
 
-template <typename type, typename atype, typename... atypes, typename std :: enable_if <!(std :: is_same <typename std :: remove_const <typename std :: remove_reference <atype> :: type> :: type, type> :: value)> :: type *> inline void __ngc_constructor__ <false, true> :: execute(type & that, atype && argument, atypes && ... arguments)
+template <typename type, typename atype, typename... atypes, typename std :: enable_if <!(std :: is_same <typename std :: remove_const <typename std :: remove_reference <atype> :: type> :: type, type> :: value) && __ngc_is_introspected__ <type> :: value> :: type *> inline void __ngc_constructor__ <false, true> :: execute(type & that, atype && argument, atypes && ... arguments)
 {
   that.__ngc_construct__(std :: forward <atype> (argument), std :: forward <atypes> (arguments)...);
 }
 
+template <typename type, typename atype, typename... atypes, typename std :: enable_if <!(std :: is_same <typename std :: remove_const <typename std :: remove_reference <atype> :: type> :: type, type> :: value) && !(__ngc_is_introspected__ <type> :: value)> :: type *> inline void __ngc_constructor__ <false, true> :: execute(type & that, atype && argument, atypes && ... arguments)
+{
+  new (&that) type(std :: forward <atype> (argument), std :: forward <atypes> (arguments)...);
+}
+
 template <bool is_class> template <bool dummy> template <typename type> inline void __ngc_constructor__ <true, is_class> :: iterator <0, dummy> :: execute(type & that)
 {
-  __ngc_constructor__ <false, is_class> :: execute(that[__ngc_array_traits__ <type> :: size - 1]);
+  __ngc_construct__(that[__ngc_array_traits__ <type> :: size - 1]);
 }
 
 template <bool is_class> template <bool dummy> template <typename type, typename atype, typename std :: enable_if <!(std :: is_array <typename std :: remove_reference <atype> :: type> :: value)> :: type *> inline void __ngc_constructor__ <true, is_class> :: iterator <0, dummy> :: execute(type & that, atype && argument)
 {
-  __ngc_constructor__ <false, is_class> :: execute(that[__ngc_array_traits__ <type> :: size - 1], std :: forward <atype> (argument));
+  __ngc_construct__(that[__ngc_array_traits__ <type> :: size - 1], std :: forward <atype> (argument));
 }
 
 template <bool is_class> template <bool dummy> template <typename type, typename atype, typename std :: enable_if <std :: is_array <typename std :: remove_reference <atype> :: type> :: value> :: type *> inline void __ngc_constructor__ <true, is_class> :: iterator <0, dummy> ::  execute(type & that, atype && argument)
 {
-  __ngc_constructor__ <false, is_class> :: execute(that[__ngc_array_traits__ <type> :: size - 1], std :: forward <__ngc_array_traits__ <atype> :: type> (argument[__ngc_array_traits__ <type> :: size - 1]));
+  __ngc_construct__(that[__ngc_array_traits__ <type> :: size - 1], std :: forward <atype> (argument)[__ngc_array_traits__ <type> :: size - 1]);
 }
 
 template <bool is_class> template <size_t index, bool dummy> template <typename type> inline void __ngc_constructor__ <true, is_class> :: iterator <index, dummy> :: execute(type & that)
 {
-  __ngc_constructor__ <false, is_class> :: execute(that[__ngc_array_traits__ <type> :: size - 1 - index]);
+  __ngc_construct__(that[__ngc_array_traits__ <type> :: size - 1 - index]);
   iterator <index - 1, false> :: execute(that);
 }
 
 template <bool is_class> template <size_t index, bool dummy> template <typename type, typename atype, typename... atypes, typename std :: enable_if <!(std :: is_array <typename std :: remove_reference <atype> :: type> :: value)> :: type *> inline void __ngc_constructor__ <true, is_class> :: iterator <index, dummy> :: execute(type & that, atype && argument, atypes && ... arguments)
 {
-  __ngc_constructor__ <false, is_class> :: execute(that[__ngc_array_traits__ <type> :: size - 1 - index], std :: forward <atype> (argument));
+  __ngc_construct__(that[__ngc_array_traits__ <type> :: size - 1 - index], std :: forward <atype> (argument));
   iterator <index - 1, false> :: execute(that, std :: forward <atypes> (arguments)...);
 }
 
 template <bool is_class> template <size_t index, bool dummy> template <typename type, typename atype, typename std :: enable_if <std :: is_array <typename std :: remove_reference <atype> :: type> :: value> :: type *> inline void __ngc_constructor__ <true, is_class> :: iterator <index, dummy> ::  execute(type & that, atype && argument)
 {
-  __ngc_constructor__ <false, is_class> :: execute(that[__ngc_array_traits__ <type> :: size - 1 - index], std :: forward <__ngc_array_traits__ <atype> :: type> (argument[__ngc_array_traits__ <type> :: size - 1 - index]));
-  iterator <index - 1, false> :: execute(that, argument);
+  __ngc_construct__(that[__ngc_array_traits__ <type> :: size - 1 - index], std :: forward <atype> (argument)[__ngc_array_traits__ <type> :: size - 1 - index]);
+  iterator <index - 1, false> :: execute(that, std :: forward <atype> (argument));
 }
 
 template <bool is_class> template <typename type, typename... atypes> inline void __ngc_constructor__ <true, is_class> :: execute(type & that, atypes && ... arguments)
 {
-  iterator <__ngc_array_traits__ <type> :: size - 1, false> :: execute(that, arguments...);
+  iterator <__ngc_array_traits__ <type> :: size - 1, false> :: execute(that, std :: forward <atypes> (arguments)...);
 }
 
 template <typename type, typename... atypes> inline void __ngc_construct__(type & that, atypes && ... arguments)
 {
+#ifdef NGC_INSTRUMENT
+  __ngc_instrument__ :: record <type> (__ngc_instrument__ :: construct, &that);
+#endif
+
   __ngc_constructor__ <std :: is_array <type> :: value, std :: is_class <typename __ngc_array_traits__ <type> :: type> :: value> :: execute(that, std :: forward <atypes> (arguments)...);
 }
 
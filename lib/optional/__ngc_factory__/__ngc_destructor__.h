@@ -13,6 +13,39 @@
 #ifndef __lib__optional____ngc_factory______ngc_destructor____h
 #define __lib__optional____ngc_factory______ngc_destructor____h
 
+#include <cstddef>
+#include <type_traits>
+
+#include "__ngc_array_traits__.h"
+#include "../../__ngc_parameter_pack__.h"
+#include "../../introspection/__ngc_member_count__.h"
+#include "../../introspection/__ngc_base_count__.h"
+#include "../../introspection/__ngc_is_introspected__.h"
+
+/**
+  \class __ngc_is_trivially_destructible__
+  \brief Determines if \c __ngc_destruct__ can skip an object altogether.
+
+  An object whose destructor is trivial does not need to be walked: neither
+  its members nor the elements of an array need destruction. When
+  \c NGC_INSTRUMENT is defined, no object is skipped, so that the destruction
+  of every member and array element is recorded, as its construction is.
+
+  \param type The type to test.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+template <typename type> struct __ngc_is_trivially_destructible__
+{
+#ifdef NGC_INSTRUMENT
+  static constexpr bool value = false; /**< Always \c false, so that members and array elements are recorded when destructed. */
+#else
+  static constexpr bool value = std :: is_trivially_destructible <type> :: value; /**< \c true if a \c type object needs no destruction, \c false otherwise. */
+#endif
+};
+
 template <bool is_array, bool is_class> struct __ngc_destructor__;
 
 template <> struct __ngc_destructor__ <false, false>
@@ -22,36 +55,22 @@ template <> struct __ngc_destructor__ <false, false>
 
 template <> struct __ngc_destructor__ <false, true>
 {
-  struct null_iterator
-  {
-    template <typename type> static inline void execute(type & that);
-  };
-
-  template <size_t index, bool dummy> struct member_iterator;
-
-  template <bool dummy> struct member_iterator <0, dummy>
-  {
-    template <typename type> static inline void execute(type & that);
-  };
+  template <typename pack> struct member_iterator;
 
-  template <size_t index, bool dummy> struct member_iterator
+  template <size_t... indexes> struct member_iterator <__ngc_index_pack__ <indexes...>>
   {
     template <typename type> static inline void execute(type & that);
   };
 
-  template <size_t index, bool dummy> struct base_iterator;
-
-  template <bool dummy> struct base_iterator <0, dummy>
-  {
-    template <typename type> static inline void execute(type & that);
-  };
+  template <typename pack> struct base_iterator;
 
-  template <size_t index, bool dummy> struct base_iterator
+  template <size_t... indexes> struct base_iterator <__ngc_index_pack__ <indexes...>>
   {
     template <typename type> static inline void execute(type & that);
   };
 
-  template <typename type> static inline void execute(type & that);
+  template <typename type, typename std :: enable_if <__ngc_is_introspected__ <type> :: value> :: type * = nullptr> static inline void execute(type & that);
+  template <typename type, typename std :: enable_if <!(__ngc_is_introspected__ <type> :: value)> :: type * = nullptr> static inline void execute(type & that);
 };
 
 template <bool is_class> struct __ngc_destructor__ <true, is_class>
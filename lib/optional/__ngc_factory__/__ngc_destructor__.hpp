@@ -13,42 +13,31 @@
 #ifndef __lib__optional____ngc_factory______ngc_destructor____hpp
 #define __lib__optional____ngc_factory______ngc_destructor____hpp
 
-template <typename type> inline void __ngc_destructor__ <false, false> :: execute(type & that)
+template <typename type> inline void __ngc_destructor__ <false, false> :: execute(type &)
 {
 }
 
-template <typename type> inline void __ngc_destructor__ <false, true> :: null_iterator :: execute(type & that)
+template <size_t... indexes> template <typename type> inline void __ngc_destructor__ <false, true> :: member_iterator <__ngc_index_pack__ <indexes...>> :: execute(type & that)
 {
+  (__ngc_destruct__(type :: template __ngc_member__ <indexes, false> :: get(that)), ...);
 }
 
-template <bool dummy> template <typename type> inline void __ngc_destructor__ <false, true> :: member_iterator <0, dummy> :: execute(type & that)
+template <size_t... indexes> template <typename type> inline void __ngc_destructor__ <false, true> :: base_iterator <__ngc_index_pack__ <indexes...>> :: execute(type & that)
 {
-  __ngc_destruct__(type :: template __ngc_member__ <0, false> :: get(that));
+  (__ngc_destruct__((typename type :: template __ngc_base__ <indexes, false> :: type &) that), ...);
 }
 
-template <size_t index, bool dummy> template <typename type> inline void __ngc_destructor__ <false, true> :: member_iterator <index, dummy> :: execute(type & that)
+template <typename type, typename std :: enable_if <__ngc_is_introspected__ <type> :: value> :: type *> inline void __ngc_destructor__ <false, true> :: execute(type & that)
 {
-  member_iterator <index - 1, false> :: execute(that);
-  __ngc_destruct__(type :: template __ngc_member__ <index, false> :: get(that));
-}
-
-template <bool dummy> template <typename type> inline void __ngc_destructor__ <false, true> :: base_iterator <0, dummy> :: execute(type & that)
-{
-  __ngc_destruct__((typename type :: template __ngc_base__ <0, false> :: type &) that);
-}
+  that.__ngc_destruct__();
 
-template <size_t index, bool dummy> template <typename type> inline void __ngc_destructor__ <false, true> :: base_iterator <index, dummy> :: execute(type & that)
-{
-  base_iterator <index - 1, false> :: execute(that);
-  __ngc_destruct__((typename type :: template __ngc_base__ <index, false> :: type &) that);
+  member_iterator <typename __ngc_make_index_pack__ <__ngc_member_count__ <type> :: value> :: type> :: execute(that);
+  base_iterator <typename __ngc_make_index_pack__ <__ngc_base_count__ <type> :: value> :: type> :: execute(that);
 }
 
-template <typename type> inline void __ngc_destructor__ <false, true> :: execute(type & that)
+template <typename type, typename std :: enable_if <!(__ngc_is_introspected__ <type> :: value)> :: type *> inline void __ngc_destructor__ <false, true> :: execute(type & that)
 {
-  that.__ngc_destruct__();
-
-  std :: conditional <__ngc_member_count__ <type> :: value != 0, member_iterator <__ngc_member_count__ <type> :: value - 1, false>, null_iterator> :: type :: execute(that);
-  std :: conditional <__ngc_base_count__ <type> :: value != 0, base_iterator <__ngc_base_count__ <type> :: value - 1, false>, null_iterator> :: type :: execute(that);
+  that.~type();
 }
 
 template <bool is_class> template <bool dummy> template <typename type> inline void __ngc_destructor__ <true, is_class> :: iterator <0, dummy> :: execute(type & that)
@@ -69,7 +58,11 @@ template <bool is_class> template <typename type> inline void __ngc_destructor__
 
 template <typename type> void __ngc_destruct__(type & that)
 {
-  __ngc_destructor__ <__ngc_array_traits__ <type> :: is_array, std :: is_class <typename __ngc_array_traits__ <type> :: type> :: value> :: execute(that);
+#ifdef NGC_INSTRUMENT
+  __ngc_instrument__ :: record <type> (__ngc_instrument__ :: destruct, &that);
+#endif
+
+  __ngc_destructor__ <__ngc_array_traits__ <type> :: is_array && !(__ngc_is_trivially_destructible__ <type> :: value), std :: is_class <typename __ngc_array_traits__ <type> :: type> :: value && !(__ngc_is_trivially_destructible__ <type> :: value)> :: execute(that);
 }
 
 #endif
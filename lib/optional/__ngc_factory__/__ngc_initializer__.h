@@ -54,8 +54,15 @@
 #ifndef __lib__optional____ngc_factory______ngc_initializer____h
 #define __lib__optional____ngc_factory______ngc_initializer____h
 
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "../../__ngc_parameter_pack__.h"
+#include "../../introspection/__ngc_member_count__.h"
+#include "../../introspection/__ngc_base_count__.h"
 #include "../../string/string.h"
-#include "__ngc_initializer__.h"
+#include "__ngc_type_probe__.h"
 
 /**
   \class __ngc_initializer__
@@ -95,7 +102,9 @@
    name string) is forwarded to a call to \c __ngc_construct__ on the member.
 
   Each of the steps above is implemented by one specific service nested class
-  in \c __ngc_initializer__. See their reference for further details.
+  in \c __ngc_initializer__. See their reference for further details. No step
+  recurses on the members, on the base classes or on the arguments, so that
+  the depth of the instantiation does not grow with any of them.
 
   \param type The type of the object to initialize.
 
@@ -235,458 +244,311 @@ template <typename type> struct __ngc_initializer__
   };
 
   /**
-    \class arguments_range
-    \brief A service class that, provided with a separator type (either
-    \c ngc \c :: \c string or \c type_separator) and an \c __ngc_parameter_pack,
-    loops through the pack to find the position of the first occurrence of the
-    separator in the pack and the position of the next separator in the pack.
+    \class argument
+    \brief Tags the type of the argument at position \c index in an
+    initialization arguments list.
 
-    It does so by exposing static constexpr size_t \c beg and \c end members
-    with values corresponding to the positions of the first occurrence of the
-    separator \c needle in the parameter pack \c haystack, and of the first
-    separator after that.
+    \param index The position of the argument in the list.
+    \param atype The type of the argument, as deduced by a forwarding
+    reference.
 
-    \c arguments_range also exposes a static constexpr boolean \c found member
-    to signal if there was any occurrence of the \c needle in the \c haystack.
-    If either the needle or the separator next to it is not found, either
-    \c beg or \c end will be set to the number of entries in the haystack, i.e.,
-    to the position of the last possible element plus one.
-
-    \code
-    arguments_range <ngc :: string <'a'>, __ngc_parameter_pack__ <>>; // :: beg = 0, :: end = 0
-    arguments_range <type_separator <int>, __ngc_parameter_pack__ <type_separator <int>>>; // :: beg = 0, :: end = 1
-    arguments_range <ngc :: string <'a'>, __ngc_parameter_pack__ <int, ngc :: string <'a'>, int>>; // :: beg = 1, :: end = 3
-    arguments_range <type_separator <int>, __ngc_parameter_pack__ <int, type_separator <int>, int, ngc :: string <'b'>, char, float, double>>; // :: beg = 1, :: end = 3
-    \endcode
-
-    \param needle The separator type to search for.
-    \param haystack The parameter pack in which to search for the \c needle.
-
-    \author Matteo Monti
-    \version 0.0.3
-    \date Jul 16, 2016
+    \author agent [agent@local]
+    \version 0.0.1
+    \date Oct 18, 2026
   */
-  template <typename needle, typename haystack> struct arguments_range
+  template <size_t index, typename atype> struct argument
   {
-    /**
-      \class iterator
-      \brief A service class to determine the arguments range.
-
-      It recursively iterates over smaller and smaller \ihaystack parameter
-      packs, exploring the reversed parameter pack in \c haystack so that the
-      last iteration occurs on the first item.
-
-      Values are determined by recurring from the beginning (empty reversed
-      parameter pack) to the end (full parameter pack, the first element in
-      \c ihasystack is the last in the original \c haystack).
-
-      \param ineedle The needle to look for.
-      \param ihaystack The inverted haystack.
-
-      \author Matteo Monti
-      \version 0.0.2
-      \date Jul 16, 2016
-    */
-    template <typename ineedle, typename ihaystack> struct iterator;
-
-    template <typename ineedle> struct iterator <ineedle, __ngc_parameter_pack__ <>>
-    {
-      static constexpr bool found = false; /**< End of the recursion, i.e., beginning of the \c haystack: the needle was not found. */
-      static constexpr bool completed = false; /**< End of the recursion, i.e., beginning of the \c haystack: the string following the needle was not found. */
-
-      static constexpr size_t beg = 0; /**< End of the recursion, i.e., beginning of the \c haystack: the needle is not found, setting \c beg position to the size of the pack. */
-      static constexpr size_t end = 0; /**< End of the recursion, i.e., beginning of the \c haystack: the needle is not found, setting \c end position to the size of the pack. */
-    };
-
-    template <typename ineedle, typename ftype, typename... ftypes> struct iterator <ineedle, __ngc_parameter_pack__ <ftype, ftypes...>>
-    {
-      static constexpr bool match = std :: is_same <typename clean <ineedle> :: ctype, typename clean <ftype> :: ctype> :: value; /**< \c true if the current element (\c ftype) matches the \c needle exactly, \c false otherwise. */
-      static constexpr bool separator = is_separator <typename clean <ftype> :: ctype> :: value && arguments_range <ineedle, __ngc_parameter_pack__ <ftypes...>> :: found; /**< \c true if the current element (\c ftype) is a string and the \c needle was already found. */
+    typedef atype ftype; /**< The type of the argument, to forward it with. */
+  };
 
-      static constexpr bool found = match || iterator <ineedle, __ngc_parameter_pack__ <ftypes...>> :: found; /**< The \c needle was found if there is a \c match on \c ftype or if the needle was already found. */
-      static constexpr bool completed = separator || iterator <ineedle, __ngc_parameter_pack__ <ftypes...>> :: completed; /**< The search is complete if there is a separator match on ftype or if the search was already complete. */
+  /**
+    \class key
+    \brief Tags the type, without const and reference, of the argument at
+    position \c index in an initialization arguments list, so that it can be
+    matched against a separator.
 
-      static constexpr size_t beg = iterator <ineedle, __ngc_parameter_pack__ <ftypes...>> :: beg + !found; /**< The position of the \c needle is equal to the position of the needle in the \c haystack with the last element removed (i.e., the \c ihaystack with the first element removed), plus one if the \c needle was still not found. */
-      static constexpr size_t end = iterator <ineedle, __ngc_parameter_pack__ <ftypes...>> :: end + !completed; /**< The position of the separator after the \c needle is equal to the position of the separator after the \c needle in the \c haystack with the last element removed (i.e., the \c ihaystack with the last element removed), plus one if the separator after the \c needle was still not found. */
-    };
+    \param index The position of the argument in the list.
+    \param ctype The type of the argument, without const and reference.
 
-    static constexpr bool found = iterator <needle, typename __ngc_reverse_parameter_pack__ <haystack> :: type> :: found; /**< \c true if \c needle is found, \c false otherwise. */
-    static constexpr size_t beg = iterator <needle, typename __ngc_reverse_parameter_pack__ <haystack> :: type> :: beg; /**< The position of the first occurrence of \c needle in \c haystack. */
-    static constexpr size_t end = iterator <needle, typename __ngc_reverse_parameter_pack__ <haystack> :: type> :: end; /**< The position of the first occurence of a separator after \c needle in \c haystack. */
+    \author agent [agent@local]
+    \version 0.0.1
+    \date Oct 18, 2026
+  */
+  template <size_t index, typename ctype> struct key
+  {
   };
 
   /**
-    \class back_step
-    \brief Last step of argument selection, removes entries from the last part
-    of the argument list, the forwards the call to \c __ngc_construct__.
-
-    After removing from the beginning of the arguments list and rotating all the
-    arguments that need to be forwarded at the end of the arguments list,
-    \c back_step takes care of removing the last items from the arguments list
-    by popping from the beginning of the arguments list all the unnecessary
-    items after the ones that need to be forwarded have been rotated to the end.
+    \class argument_list
+    \brief Tags the types of all the arguments in an initialization arguments
+    list, with one \c argument and one \c key base class each.
 
-    For further reference, see \c front_step and \c rotate_step.
+    The base classes are listed with a single pack expansion. The type of an
+    argument is retrieved by \c pick, and the position of a separator by
+    \c locate, whose deductions select the only base class with the requested
+    position or type. Neither requires a recursion on the arguments, nor a
+    comparison of the separator with each of them.
 
-    \param back The number of elements to be removed from the back of the
-    arguments list.
-    \param dummy A dummy boolean parameter.
+    \param pack An \c __ngc_index_pack__ with the positions of the arguments.
+    \param atypes... The types of the arguments.
 
-    \author Matteo Monti
-    \version 0.0.2
-    \date Jul 22, 2016
+    \author agent [agent@local]
+    \version 0.0.1
+    \date Oct 18, 2026
   */
-  template <size_t back, bool dummy> struct back_step;
-
-  template <bool dummy> struct back_step <0, dummy>
-  {
-    /**
-      \brief Forwards the arguments to \c __ngc_construct__.
-      \param that The object to be initialized.
-      \param arguments... The arguments to \c member constructor.
-    */
-    template <typename ttype, typename... atypes> static inline void execute(ttype & that, atypes && ... arguments);
-  };
+  template <typename pack, typename... atypes> struct argument_list;
 
-  template <size_t back, bool dummy> struct back_step
+  template <size_t... indexes, typename... atypes> struct argument_list <__ngc_index_pack__ <indexes...>, atypes...> : argument <indexes, atypes>..., key <indexes, typename clean <atypes> :: ctype>...
   {
-    /**
-      \brief Removes the first argument from the argument list, then iterates on
-      the next \c back_step.
-      \param that The object to be initialized.
-      \param argument The argument to be removed.
-      \param arguments... The arguments to forward to the next \c back_step.
-    */
-    template <typename ttype, typename atype, typename... atypes> static inline void execute(ttype & that, atype && argument, atypes && ... arguments);
+    static constexpr bool separators[] = {is_separator <typename clean <atypes> :: ctype> :: value..., false}; /**< For each argument, \c true if it is a separator (the last flag is padding). */
   };
 
   /**
-    \class rotate_step
-    \brief Second step of argument selection, rotates the arguments that need
-    to be forwarded to \c __ngc_construct__ to the end of the arguments list.
-
-    This step does so so that the last arguments can be removed from the front
-    by \c back_step. Note that it is only possible to remove an element from the
-    beginning of an argument list. Therefore, to remove all the arguments that
-    come after the end of the argument range specified, it is necessary to first
-    remove all the unnecessary elements from the beginning, then to move all the
-    arguments that need to be moved to the end of the arguments list (and this
-    is what \c rotate_step does), then remove the elements after the selection
-    range that now appear at the beginning of the arguments list.
-
-    For further reference, see \c front_step and \c back_step.
-
-    \param rotate The number of elements to be moved to the end of the arguments
-    list.
-    \param back The number of steps that need to be performed by \c back_step
-    after \c rotate_step is concluded.
-
-    \author Matteo Monti
-    \version 0.0.2
-    \date Jul 22, 2016
+    \brief Declared only, to retrieve in unevaluated context the \c argument
+    base class of an \c argument_list at position \c index.
   */
-  template <size_t rotate, size_t back> struct rotate_step;
+  template <size_t index, typename atype> static argument <index, atype> pick(const argument <index, atype> *);
 
-  template <size_t back> struct rotate_step <0, back>
-  {
-    /**
-      \brief Forwards the arguments to \c back_step.
-      \param that The object to be initialized.
-      \param arguments... The arguments to be forwarded to \c back_step.
-    */
-    template <typename ttype, typename... atypes> static inline void execute(ttype & that, atypes && ... arguments);
-  };
+  /**
+    \brief Returns the position of the only argument of type \c ctype in an
+    \c argument_list.
 
-  template <size_t rotate, size_t back> struct rotate_step
+    Deduction fails if no argument, or more than one, has type \c ctype: the
+    overload below is then selected.
+  */
+  template <typename ctype, size_t index> static constexpr size_t locate(const key <index, ctype> *, size_t)
   {
-    /**
-      \brief Moves the first argument to the end of the arguments list, then
-      recurs on the next \c rotate_step.
-      \param that The object to be initialized.
-      \param argument The argument to be moved at the end of the arguments list.
-      \param arguments... The remaining arguments.
-    */
-    template <typename ttype, typename atype, typename... atypes> static inline void execute(ttype & that, atype && argument, atypes && ... arguments);
-  };
+    return index;
+  }
 
   /**
-    \class front_step
-    \brief First step of argument selection, removes the first unnecessary
-    arguments from the arguments list.
-
-    \c front_step is the first step in the argument selection process. It takes
-    care of removing the first elements that don't belong to the arguments range
-    from the beginning of the arguments list. It does so by recursively removing
-    one element from the beginning of the arguments list until all the
-    unnecessary arguments have been removed.
-
-    After \c front_step is concluded, the arguments are forwarded to
-    \c rotate_step, which takes care of moving all the arguments in the argument
-    range at the end of the arguments list, so that \c back_step can remove
-    the trailing unnecessary arguments.
-
-    For further reference, see \c rotate_step and \c back_step.
-
-    \param front The number of elements to be removed from the beginning of the
-    arguments list.
-    \param rotate The number of steps that need to be performed by
-    \c rotate_step after \c front_step is concluded.
-    \param back The number of steps that need to be performed by
-    \c back_step after \c rotate_step is concluded.
-
-    \author Matteo Monti
-    \version 0.0.2
-    \date Jul 22, 2016
+    \brief Returns \c size, i.e., the number of arguments in the list, if no
+    argument, or more than one, has type \c ctype.
   */
-  template <size_t front, size_t rotate, size_t back> struct front_step;
-
-  template <size_t rotate, size_t back> struct front_step <0, rotate, back>
+  template <typename ctype> static constexpr size_t locate(const void *, size_t size)
   {
-    /**
-      \brief Forwards the arguments to \c rotate_step.
-      \param that The object to be initialized.
-      \param arguments... The arguments to be forwarded to \c rotate_step.
-    */
-    template <typename ttype, typename... atypes> static inline void execute(ttype & object, atypes && ... arguments);
-  };
+    return size;
+  }
 
-  template <size_t front, size_t rotate, size_t back> struct front_step
+  /**
+    \brief Returns the position of the first flag set in \c flags from
+    position \c from on, or \c size if none is.
+  */
+  static constexpr size_t first(const bool * flags, size_t from, size_t size)
   {
-    /**
-      \brief Removes the first argument from the arguments list, then recurs
-      on the next \c front_step.
-      \param that The object to be initialized.
-      \param argument The argument to be removed.
-      \param arguments... The argument on which to recur.
-    */
-    template <typename ttype, typename atype, typename... atypes> static inline void execute(ttype & that, atype && argument, atypes && ... arguments);
-  };
+    while(from < size && !(flags[from]))
+      from++;
+
+    return from;
+  }
 
   /**
-    \class member_initializer
-    \brief Provided with a member name, initializes the member by appropriately
-    selecting the arguments from the initialization arguments, or by calling
-    the default constructor if the name does not appear in the initialization
-    arguments.
-
-    \c member_initializer serves the purpose to initialize a member. Provided
-    with a string containing the member name, it will use \c arguments_range
-    to determine wether or not the member name appears among the initialization
-    arguments. If so, it calls \c front_step to select the arguments based on
-    the range determined by \c arguments_range and to forward them to an
-    appropriate call to \c __ngc_construct__ on the member. If the name of the
-    member is not found on the initialization arguments list, then the default
-    \c __ngc_construct__ is called on the member.
-
-    \param name The name of the member to be initialized.
-
-    \author Matteo Monti
+    \class unique
+    \brief Asserts that a separator appears at most once in an
+    initialization arguments list (i.e., that no member or base class is
+    initialized twice).
+
+    \c unique is only instantiated for the separators that \c locate did not
+    find, since those that appear more than once are among them. It compares
+    the separator with every argument, by overload resolution on \c same
+    rather than by instantiating \c std \c :: \c is_same for each of them.
+
+    \param needle The separator.
+    \param ctypes... The types of the arguments, without const and reference.
+
+    \author agent [agent@local]
     \version 0.0.1
-    \date Jul 16, 2016
+    \date Oct 18, 2026
   */
-  template <typename name> struct member_initializer
+  template <typename needle, typename... ctypes> struct unique
   {
-    /**
-      \class parametric_initializer
-      \brief Calls \c front_step on the member, thus forwarding to
-      \c __ngc_construct__ the appropriate arguments range determined by
-      \c arguments_range.
-    */
-    struct parametric_initializer
+    template <typename stype> static constexpr bool same(stype *, stype *)
     {
-      /**
-        \brief Calls \c front_step on the member and the arguments, with a
-        number of steps determined by \c arguments_range, so that the arguments
-        for \c __ngc_construct__ are those specified in the initialization
-        arguments list.
-        \param member The member to be initialized.
-        \param arguments... The initialization list arguments to be filtered
-        against the arguments range.
-      */
-      template <typename mtype, typename... atypes> static inline void execute(mtype & member, atypes && ... arguments);
-    };
+      return true;
+    }
 
-    /**
-      \class default_initializer
-      \brief Calls the default \c __ngc_construct__ on a member.
-    */
-    struct default_initializer
+    static constexpr bool same(...)
     {
-      /**
-        \brief Calls the default \c __ngc_construct__ on a member.
-        \param member The member to be constructed.
-        \arguments... The arguments in the initialization arguments list (they
-        are ignored).
-      */
-      template <typename mtype, typename... atypes> static inline void execute(mtype & member, atypes && ... arguments);
-    };
+      return false;
+    }
 
-    /**
-    \brief Uses \c arguments_range to determine wether or not \c name appears
-    in the initialization arguments list: if so, it calls the
-    \c parametric_initializer, otherwise it calls the \c default_initializer.
-    */
-    template <typename mtype, typename... atypes> static inline void execute(mtype & member, atypes && ... arguments);
+    static constexpr size_t count = (0 + ... + (size_t) same((needle *) nullptr, (ctypes *) nullptr)); /**< The number of occurrences of \c needle in the arguments. */
+
+    static_assert(count <= 1, "A member or a base class is initialized more than once.");
+
+    static constexpr bool value = true; /**< \c true. */
   };
 
   /**
-    \class base_initializer
-    \brief Provided with a type, initializes the base class of that type by
-    appropriately selecting the arguments from the initialization arguments, or
-    by calling the default constructor if the corresponding type separator does
-    not appear in the initialization arguments.
-
-    \c base_initializer serves the purpose to initialize a base class. Provided
-    with the type of the base class, it will use \c arguments_range to determine
-    wether or not the type separator for that base class appears among the
-    initialization arguments. If so, it calls \c front_step to select the
-    arguments based on the range determined by \c arguments_range and to forward
-    them to an appropriate call to \c __ngc_construct__ on the base class. If
-    the type separator for the base class is not found on the initialization
-    arguments list, then the default \c __ngc_construct__ is called on the base
-    class.
-
-    \param btype The type of the base class to be initialized.
-
-    \author Matteo Monti
+    \class selector
+    \brief Forwards a range of the arguments in an initialization arguments
+    list to \c __ngc_construct__.
+
+    The arguments are received as an array of pointers, one for each argument
+    in the list, so that the only types \c selector depends on are those of
+    the arguments it forwards. The functions that are instantiated for each
+    member or base class therefore do not carry all the types of the
+    arguments list, whose size would otherwise grow quadratically with the
+    number of arguments.
+
+    \param offset The position of the first argument to forward.
+    \param pack An \c __ngc_index_pack__ with the positions, relative to
+    \c offset, of the arguments to forward.
+    \param stypes... The types of the arguments to forward.
+
+    \author agent [agent@local]
     \version 0.0.1
-    \date Jul 24, 2016
+    \date Oct 18, 2026
   */
-  template <typename btype> struct base_initializer
+  template <size_t offset, typename pack, typename... stypes> struct selector;
+
+  template <size_t offset, size_t... indexes, typename... stypes> struct selector <offset, __ngc_index_pack__ <indexes...>, stypes...>
   {
     /**
-      \class parametric_initializer
-      \brief Calls \c front_step on the base class, thus forwarding to
-      \c __ngc_construct__ the appropriate arguments range determined by
-      \c arguments_range.
+      \brief Forwards the arguments at positions \c offset plus \c indexes to
+      \c __ngc_construct__ on \c that.
+      \param that The object to be initialized.
+      \param pointers The addresses of the initialization arguments.
     */
-    struct parametric_initializer
-    {
-      /**
-        \brief Calls \c front_step on the base class and the arguments, with a
-        number of steps determined by \c arguments_range, so that the arguments
-        for \c __ngc_construct__ are those specified in the initialization
-        arguments list.
-        \param base The base class to be initialized.
-        \param arguments... The initialization list arguments to be filtered
-        against the arguments range.
-      */
-      template <typename... atypes> static inline void execute(btype & base, atypes && ... arguments);
-    };
+    template <typename ttype> static inline void execute(ttype & that, void * const * pointers);
+  };
+
+  /**
+    \class arguments_range
+    \brief A service class that, provided with a separator type (either
+    \c ngc \c :: \c string or \c type_separator) and an \c __ngc_parameter_pack,
+    determines the position of the occurrence of the separator in the pack and
+    the position of the next separator in the pack.
+
+    It does so by exposing static constexpr size_t \c beg and \c end members
+    with values corresponding to the positions of the occurrence of the
+    separator \c needle in the parameter pack \c haystack, and of the first
+    separator after that.
+
+    \c arguments_range also exposes a static constexpr boolean \c found member
+    to signal if there was any occurrence of the \c needle in the \c haystack.
+    If either the needle or the separator next to it is not found, either
+    \c beg or \c end will be set to the number of entries in the haystack, i.e.,
+    to the position of the last possible element plus one. A \c needle that
+    appears more than once in the \c haystack fails a static assertion.
+
+    Finally, it exposes as \c forward the \c selector that forwards the
+    arguments between \c beg and \c end to \c __ngc_construct__, i.e., that
+    calls the default \c __ngc_construct__ if the \c needle is not found.
+
+    \c needle is located by \c locate, and the next separator is found by
+    scanning, in a constexpr function, the flags in \c argument_list that mark
+    the separators, that are shared by all the needles searched in the same
+    \c haystack. No entity that \c arguments_range instantiates for a
+    \c needle is named after all the types in \c haystack, so that neither
+    the depth of the instantiation nor the size of the names it produces grow
+    with the number of arguments.
+
+    \code
+    arguments_range <ngc :: string <'a'>, __ngc_parameter_pack__ <>>; // :: beg = 0, :: end = 0
+    arguments_range <type_separator <int>, __ngc_parameter_pack__ <type_separator <int>>>; // :: beg = 0, :: end = 1
+    arguments_range <ngc :: string <'a'>, __ngc_parameter_pack__ <int, ngc :: string <'a'>, int>>; // :: beg = 1, :: end = 3
+    arguments_range <type_separator <int>, __ngc_parameter_pack__ <int, type_separator <int>, int, ngc :: string <'b'>, char, float, double>>; // :: beg = 1, :: end = 3
+    \endcode
+
+    \param needle The separator type to search for.
+    \param haystack The parameter pack in which to search for the \c needle.
+
+    \author Matteo Monti, agent [agent@local]
+    \version 0.0.4
+    \date Jul 16, 2016
+  */
+  template <typename needle, typename haystack> struct arguments_range;
+
+  template <typename needle, typename... htypes> struct arguments_range <needle, __ngc_parameter_pack__ <htypes...>>
+  {
+    static constexpr size_t size = sizeof...(htypes); /**< The number of entries in the \c haystack. */
+
+    typedef argument_list <typename __ngc_make_index_pack__ <size> :: type, htypes...> list; /**< The entries in the \c haystack, tagged by position. */
+
+    static constexpr size_t beg = locate <typename clean <needle> :: ctype> ((list *) nullptr, size); /**< The position of the occurrence of \c needle in \c haystack. */
+    static constexpr bool found = beg < size; /**< \c true if \c needle is found, \c false otherwise. */
+    static constexpr size_t end = found ? first(list :: separators, beg + 1, size) : size; /**< The position of the first occurence of a separator after \c needle in \c haystack. */
+
+    static_assert(std :: conditional <found, std :: true_type, unique <typename clean <needle> :: ctype, typename clean <htypes> :: ctype...>> :: type :: value, "");
 
     /**
-      \class default_initializer
-      \brief Calls the default \c __ngc_construct__ on a base class.
+      \class selection
+      \brief Provides, as \c forward, the \c selector that forwards the
+      arguments at positions \c beg plus one plus \c indexes.
     */
-    struct default_initializer
+    template <typename pack> struct selection;
+
+    template <size_t... indexes> struct selection <__ngc_index_pack__ <indexes...>>
     {
-      /**
-        \brief Calls the default \c __ngc_construct__ on a base class.
-        \param base The base class to be constructed.
-        \arguments... The arguments in the initialization arguments list (they
-        are ignored).
-      */
-      template <typename... atypes> static inline void execute(btype & base, atypes && ... arguments);
+      typedef selector <beg + 1, __ngc_index_pack__ <indexes...>, typename decltype(pick <beg + 1 + indexes> ((list *) nullptr)) :: ftype...> forward; /**< The \c selector. */
     };
 
-    /**
-    \brief Uses \c arguments_range to determine wether or not \c type_separator
-    \c <type> appears in the initialization arguments list: if so, it calls the
-    \c parametric_initializer, otherwise it calls the \c default_initializer.
-    */
-    template <typename... atypes> static inline void execute(btype & base, atypes && ... arguments);
+    typedef typename selection <typename __ngc_make_index_pack__ <found ? end - beg - 1 : 0> :: type> :: forward forward; /**< The \c selector that forwards the arguments between \c beg and \c end to \c __ngc_construct__. */
   };
 
   /**
     \class member_iterator
-    \brief Iterates through all the members in the object and calls
-    \c member_initializer on all of them, providing them with the initialization
-    arguments list.
+    \brief Iterates through all the members in the object and initializes
+    each of them with the \c selector that \c arguments_range provides for
+    its name, i.e., with its arguments in the initialization arguments list.
 
-    \param index The index of the member to initialize.
-    \dummy A dummy boolean parameter.
+    The members are iterated on with a single pack expansion on the indexes in
+    \c pack, rather than with a recursion, so that the depth of the
+    instantiation does not grow with the number of members.
 
-    \author Matteo Monti
+    \param pack An \c __ngc_index_pack__ with the indexes of the members to
+    initialize.
+
+    \author Matteo Monti, agent [agent@local]
     \version 0.0.1
     \date Jul 16, 2016
   */
-  template <size_t index, bool dummy> struct member_iterator;
-
-  template <bool dummy> struct member_iterator <0, dummy>
-  {
-    /**
-      \brief Provided with an object and an initialization arguments list, it
-      initializes the first member in the object as stated in the initialization
-      list.
-      \param that The object to be initialized.
-      \param arguments... The initialization arguments.
-    */
-    template <typename... atypes> static inline void execute(type & that, atypes && ... arguments);
-  };
+  template <typename pack> struct member_iterator;
 
-  template <size_t index, bool dummy> struct member_iterator
+  template <size_t... indexes> struct member_iterator <__ngc_index_pack__ <indexes...>>
   {
     /**
       \brief Provided with an object and an initialization arguments list, it
-      recurs on the next \c member_iterator then initializes the member at
-      \c index position in the object as stated in the initialization list.
+      initializes the members at \c indexes in the object, in order, as stated
+      in the initialization list.
+      \param atypes... The types of the initialization arguments.
       \param that The object to be initialized.
-      \param arguments... The initialization arguments.
+      \param pointers The addresses of the initialization arguments.
     */
-    template <typename... atypes> static inline void execute(type & that, atypes && ... arguments);
+    template <typename... atypes> static inline void execute(type & that, void * const * pointers);
   };
 
   /**
     \class base_iterator
-    \brief Iterates through all the base classes in the object and calls
-    \c base_initializer on all of them, providing them with the initialization
-    arguments list.
+    \brief Iterates through all the base classes in the object and
+    initializes each of them with the \c selector that \c arguments_range
+    provides for its \c type_separator, i.e., with its arguments in the
+    initialization arguments list.
 
-    \param index The index of the base class to initialize.
-    \dummy A dummy boolean parameter.
+    As for \c member_iterator, the base classes are iterated on with a single
+    pack expansion on the indexes in \c pack.
 
-    \author Matteo Monti
+    \param pack An \c __ngc_index_pack__ with the indexes of the base classes
+    to initialize.
+
+    \author Matteo Monti, agent [agent@local]
     \version 0.0.1
     \date Jul 24, 2016
   */
-  template <size_t index, bool dummy> struct base_iterator;
-
-  template <bool dummy> struct base_iterator <0, dummy>
-  {
-    /**
-      \brief Provided with an object and an initialization arguments list, it
-      initializes the first base class in the object as stated in the
-      initialization list.
-      \param that The object to be initialized.
-      \param arguments... The initialization arguments.
-    */
-    template <typename... atypes> static inline void execute(type & that, atypes && ... arguments);
-  };
+  template <typename pack> struct base_iterator;
 
-  template <size_t index, bool dummy> struct base_iterator
+  template <size_t... indexes> struct base_iterator <__ngc_index_pack__ <indexes...>>
   {
     /**
       \brief Provided with an object and an initialization arguments list, it
-      recurs on the next \c base_iterator then initializes the base class at
-      \c index position in the object as stated in the initialization list.
+      initializes the base classes at \c indexes in the object, in order, as
+      stated in the initialization list.
+      \param atypes... The types of the initialization arguments.
       \param that The object to be initialized.
-      \param arguments... The initialization arguments.
+      \param pointers The addresses of the initialization arguments.
     */
-    template <typename... atypes> static inline void execute(type & that, atypes && ... arguments);
-  };
-
-  /**
-    \class null_iterator
-    \brief An iterator placeholder for objects that have no members or base
-    classes, or primitives.
-
-    \author Matteo Monti [matteo.monti@rain.vg]
-    \version 0.0.1
-    \date Jul 16, 2016
-  */
-  struct null_iterator
-  {
-    template <typename... atypes> static inline void execute(type & that, atypes && ... arguments);
+    template <typename... atypes> static inline void execute(type & that, void * const * pointers);
   };
 };
 
@@ -740,6 +602,6 @@ template <typename type> struct __ngc_initializer__
   \verison 0.0.1
   \date Jul 16, 2016
 */
-template <typename type, typename... atypes> inline void __ngc_initialize__(type & that, atypes && ... arguments);
+template <typename type, typename... atypes> void __ngc_initialize__(type & that, atypes && ... arguments);
 
 #endif
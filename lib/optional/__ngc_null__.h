@@ -71,6 +71,6 @@ struct __ngc_null_type__
   constexpr __ngc_null_type__() {}
 };
 
-constexpr __ngc_null_type__ __ngc_null__;
+inline constexpr __ngc_null_type__ __ngc_null__;
 
 #endif
@@ -68,6 +68,6 @@ struct __ngc_default_type__
   constexpr __ngc_default_type__ () {}
 };
 
-constexpr __ngc_default_type__ __ngc_default__;
+inline constexpr __ngc_default_type__ __ngc_default__;
 
 #endif
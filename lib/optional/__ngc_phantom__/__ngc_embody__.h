@@ -40,6 +40,7 @@
 #define __lib__optional____ngc_phantom______ngc_embody____h
 
 #include <cstdint>
+#include <type_traits>
 
 #include "../__ngc_null__.h"
 #include "__ngc_phantom_base__.h"
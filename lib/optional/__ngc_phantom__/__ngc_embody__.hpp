@@ -13,11 +13,19 @@
 
 template <typename type> inline auto & __ngc_conditional_embodier__ <true> :: execute(type & that)
 {
+#ifdef NGC_INSTRUMENT
+  __ngc_instrument__ :: record <typename std :: remove_const <typename std :: remove_reference <decltype(that.__ngc_embody__())> :: type> :: type> (__ngc_instrument__ :: embody, &that);
+#endif
+
   return that.__ngc_embody__();
 }
 
 template <typename type> inline const auto & __ngc_conditional_embodier__ <true> :: execute(const type & that)
 {
+#ifdef NGC_INSTRUMENT
+  __ngc_instrument__ :: record <typename std :: remove_const <typename std :: remove_reference <decltype(that.__ngc_embody__())> :: type> :: type> (__ngc_instrument__ :: embody, &that);
+#endif
+
   return that.__ngc_embody__();
 }
 
@@ -40,8 +40,8 @@
   An \c __ngc_phantom_base__ is a null-constructible object that stores the
   bytewise representation of an object without storing the object itself as a
   member or as a base class. This allows any type to be null-constructed. It
-  does so by storing as member an array of bytes of the same size as the object
-  it phantoms.
+  does so by storing as member an array of bytes of the same size and the same
+  alignment as the object it phantoms.
 
   A null constructor is implemented as trivial constructor (no operation is
   carried out on memory). The object stored is then retrieved by reference
@@ -69,7 +69,7 @@
 */
 template <typename type> struct __ngc_phantom_base__
 {
-  int8_t _[sizeof(type)]; /**< Byte representation of \c type */
+  alignas(type) int8_t _[sizeof(type)]; /**< Byte representation of \c type, aligned as \c type so that embodying it is a plain reinterpretation of the same address. */
 
   /**
     \brief Null constructor for \c __ngc_phantom_base__.
@@ -85,7 +85,7 @@ template <typename type> struct __ngc_phantom_base__
     \see reference/optional/reference.md
     \see lib/optional/__ngc_null__.h
     */
-    __ngc_phantom_base__(__ngc_null_type__ null) {}
+    __ngc_phantom_base__(__ngc_null_type__) {}
 
     /**
     \brief Embodiment function for \c __ngc_phantom_base__, returns a reference
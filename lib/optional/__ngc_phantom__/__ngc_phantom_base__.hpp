@@ -18,7 +18,7 @@ template <typename type> inline type & __ngc_phantom_base__ <type> :: __ngc_embo
 
 template <typename type> inline const type & __ngc_phantom_base__ <type> :: __ngc_embody__() const
 {
-  return reinterpret_cast <type &> (*this);
+  return reinterpret_cast <const type &> (*this);
 }
 
 #endif
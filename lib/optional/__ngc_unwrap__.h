@@ -0,0 +1,94 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file __ngc_unwrap__.h
+
+  This file includes the declarations of \c __ngc_unwrap__ and
+  \c __ngc_coalesce__, the functions the parser lowers the \c x! and \c ??
+  optional operators to.
+
+  \c __ngc_unwrap__ returns a reference to the object wrapped in an optional.
+  Unless \c NDEBUG is defined, it first asserts that the optional exists. When
+  \c NDEBUG is defined, it reduces to a call to \c __ngc_embody__, i.e., to a
+  reinterpretation of the memory of the optional that produces no code at all.
+
+  \code
+  int? maybe_an_int = 42;
+  std :: cout << maybe_an_int! << std :: endl; // Parsed to __ngc_unwrap__(maybe_an_int)
+
+  double x = maybe_a_double() ?? 42.; // Parsed to __ngc_coalesce__(maybe_a_double(), [&]() -> decltype(auto) {return 42.;})
+  \endcode
+
+  \see reference/optional/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __lib__optional____ngc_unwrap____h
+#define __lib__optional____ngc_unwrap____h
+
+#include <cassert>
+#include <type_traits>
+#include <utility>
+
+/**
+  \fn __ngc_unwrap__
+  \brief Returns a reference to the object wrapped in an optional, asserting
+  that it exists unless \c NDEBUG is defined.
+
+  \param that The optional to unwrap.
+  \return A reference to the object wrapped in \c that.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+template <typename type> inline auto & __ngc_unwrap__(type & that);
+
+/**
+  \fn __ngc_unwrap__
+  \brief Returns a const reference to the object wrapped in an optional,
+  asserting that it exists unless \c NDEBUG is defined.
+
+  \param that The optional to unwrap.
+  \return A const reference to the object wrapped in \c that.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+template <typename type> inline const auto & __ngc_unwrap__(const type & that);
+
+/**
+  \fn __ngc_coalesce__
+  \brief Returns a copy of the object wrapped in an optional if it exists, the
+  result of a fallback otherwise.
+
+  The right-hand side of \c ?? is wrapped by the parser in a lambda, so that it
+  is only evaluated if the optional does not exist. If \c that is an rvalue
+  (e.g., an optional returned by a function), the object wrapped in it is
+  moved rather than copied.
+
+  \param that The optional to coalesce.
+  \param fallback A callable that returns the value to use if \c that does not
+  exist.
+  \return A copy of the object wrapped in \c that, or the result of
+  \c fallback converted to its type.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+template <typename otype, typename ftype> inline auto __ngc_coalesce__(otype && that, ftype && fallback);
+
+#endif
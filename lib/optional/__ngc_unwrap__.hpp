@@ -0,0 +1,37 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+*/
+
+#ifndef __lib__optional____ngc_unwrap____hpp
+#define __lib__optional____ngc_unwrap____hpp
+
+template <typename type> inline auto & __ngc_unwrap__(type & that)
+{
+  assert(that.__ngc_exists__ && "Unwrapping an optional that does not exist.");
+  return __ngc_embody__(that);
+}
+
+template <typename type> inline const auto & __ngc_unwrap__(const type & that)
+{
+  assert(that.__ngc_exists__ && "Unwrapping an optional that does not exist.");
+  return __ngc_embody__(that);
+}
+
+template <typename otype, typename ftype> inline auto __ngc_coalesce__(otype && that, ftype && fallback)
+{
+  typedef decltype(__ngc_embody__(that)) rtype;
+  typedef typename std :: remove_const <typename std :: remove_reference <rtype> :: type> :: type vtype;
+
+  if(that.__ngc_exists__)
+    return vtype(static_cast <typename std :: conditional <std :: is_lvalue_reference <otype> :: value, rtype, typename std :: remove_reference <rtype> :: type &&> :: type> (__ngc_embody__(that)));
+
+  return vtype(fallback());
+}
+
+#endif
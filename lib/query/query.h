@@ -0,0 +1,409 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file query.h
+
+  This file includes the declaration of \c soa and \c query in namespace
+  \c ngc, of the comparison predicates \c lt, \c le, \c gt, \c ge, \c eq and
+  \c ne in namespace \c ngc, and of their service class \c __ngc_query__.
+
+  An \c ngc \c :: \c soa stores the objects of an introspected class as a
+  structure of arrays, with one column for each member. Columns are named at
+  compile time by the \c ngc \c :: \c string names of the members, and
+  queries filter rows with selection bitmaps, then project and compact the
+  selected columns.
+
+  \code
+  class order
+  {
+  public:
+    uint64_t id;
+    double price;
+    uint32_t qty;
+  };
+
+  // After parser parses order ..
+
+  ngc :: soa <order> orders;
+  orders.push_back(order {1, 120.0, 3});
+
+  auto [ids, qtys] = orders.where(`price`, ngc :: gt(100)).where(`qty`, ngc :: le(10)).select(`id`, `qty`); // std :: vector <uint64_t> and std :: vector <uint32_t>.
+  \endcode
+
+  \see reference/query/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __lib__query__query__h
+#define __lib__query__query__h
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "../__ngc_parameter_pack__.h"
+#include "../introspection/__ngc_member_count__.h"
+#include "../introspection/__ngc_member_index__.h"
+#include "../introspection/__ngc_is_introspected__.h"
+#include "../string/string.h"
+
+/**
+  \class __ngc_query__
+  \brief Service class for \c ngc \c :: \c soa and \c ngc \c :: \c query that
+  implements the columns, the predicates and the scan and compaction kernels.
+
+  Rows are filtered 64 at a time, into a 64 bit word of the selection bitmap.
+  Where SSE2 is available, comparison predicates on \c float, \c double,
+  \c int32_t and \c uint32_t columns are evaluated by SSE2 kernels, that
+  compare 2 or 4 values at once and collect the results with \c movemask.
+  Other predicates are evaluated into an array of 64 byte flags, in a loop
+  with no branches and no dependencies across iterations, that the compiler
+  can vectorize, and the flags are then packed into the word. Blocks whose
+  word is already empty are not scanned again by further predicates.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+struct __ngc_query__
+{
+  static constexpr size_t block = 64; /**< The number of rows in each word of a selection bitmap. */
+
+  /**
+    \brief The comparisons implemented by \c predicate.
+  */
+  enum comparison
+  {
+    less, /**< \c lt */
+    less_equal, /**< \c le */
+    greater, /**< \c gt */
+    greater_equal, /**< \c ge */
+    equal, /**< \c eq */
+    not_equal /**< \c ne */
+  };
+
+  /**
+    \class predicate
+    \brief Compares the values of a column with a constant.
+    \param op The comparison.
+    \param vtype The type of the constant.
+  */
+  template <comparison op, typename vtype> struct predicate
+  {
+    vtype value; /**< The constant. */
+
+    /**
+      \brief Compares a value of the column with the constant.
+
+      Arithmetic values are compared in the common type of \c etype and
+      \c vtype, to which both are explicitly converted, with the same result
+      as the C++ operator and with no sign comparison warnings.
+
+      \param that The value of the column.
+      \return The result of the comparison.
+    */
+    template <typename etype> inline bool operator () (const etype & that) const;
+  };
+
+  /**
+    \class simd
+    \brief Determines if a predicate on a column of \c etype values is
+    evaluated by an SSE2 kernel.
+
+    This is the case for comparison predicates on \c float, \c double,
+    \c int32_t and \c uint32_t columns, whose comparison (after the usual
+    arithmetic conversions) is carried out in the type of the column, so that
+    converting the constant to the type of the column does not change the
+    result.
+  */
+  template <typename ptype, typename etype> struct simd : std :: false_type
+  {
+  };
+
+  template <comparison op, typename vtype, typename etype> struct simd <predicate <op, vtype>, etype>
+  {
+#if defined(__SSE2__) && defined(__GNUG__)
+    static constexpr bool value = (std :: is_same <etype, float> :: value || std :: is_same <etype, double> :: value || std :: is_same <etype, int32_t> :: value || std :: is_same <etype, uint32_t> :: value) && std :: is_arithmetic <vtype> :: value && std :: is_same <typename std :: common_type <etype, vtype> :: type, etype> :: value;
+#else
+    static constexpr bool value = false;
+#endif
+  };
+
+  /**
+    \brief Converts, once for a whole scan, the constant of a comparison
+    predicate on a column of \c etype values to the type the comparison is
+    carried out in, i.e., the common type of \c etype and of the constant.
+
+    The SSE2 kernels and the scalar loop then compare the values of the column
+    with the same converted constant, and agree with the C++ operator: as in
+    C++, e.g., a negative constant compared with a \c uint32_t column wraps
+    around, so that \c ngc \c :: \c gt(-1) selects no row. Other predicates
+    are returned as they are.
+
+    \param test The predicate.
+  */
+  template <typename etype, typename ptype> static inline const ptype & bind(const ptype & test);
+  template <typename etype, comparison op, typename vtype, typename std :: enable_if <std :: is_arithmetic <etype> :: value && std :: is_arithmetic <vtype> :: value> :: type * = nullptr> static inline predicate <op, typename std :: common_type <etype, vtype> :: type> bind(const predicate <op, vtype> & test);
+
+  /**
+    \class columns
+    \brief Provides, as \c type, a \c std \c :: \c tuple with a
+    \c std \c :: \c vector for each member of \c rtype.
+  */
+  template <typename rtype, typename = typename __ngc_make_index_pack__ <__ngc_member_count__ <rtype> :: value> :: type> struct columns;
+
+  template <typename rtype, size_t... indexes> struct columns <rtype, __ngc_index_pack__ <indexes...>>
+  {
+    typedef std :: tuple <std :: vector <typename rtype :: template __ngc_member__ <indexes, false> :: type>...> type;
+
+    static_assert(!(std :: is_same <typename rtype :: template __ngc_member__ <indexes, false> :: type, bool> :: value || ...), "bool members cannot be stored in a column, since std :: vector <bool> is not contiguous. Use uint8_t instead.");
+  };
+
+  /**
+    \brief Returns the number of set bits in a word.
+  */
+  static inline size_t popcount(uint64_t word);
+
+  /**
+    \brief Returns the index of the lowest set bit in a non-zero word.
+  */
+  static inline size_t lowest(uint64_t word);
+
+  /**
+    \brief Packs 64 byte flags, each either \c 0x00 or \c 0xff, into a word.
+    \param flags The flags, aligned to 16 bytes.
+  */
+  static inline uint64_t pack(const uint8_t * flags);
+
+  /**
+    \brief Evaluates a comparison predicate on a block of values with SSE2.
+    Only available if \c simd is \c true for the predicate and the column.
+    \param values The \c block values.
+    \param test The predicate.
+    \return A word whose bit \c i is set if and only if \c values[i]
+    satisfies the predicate.
+  */
+  template <comparison op, typename vtype, typename etype> static inline uint64_t kernel(const etype * values, const predicate <op, vtype> & test);
+
+  /**
+    \brief Evaluates a predicate on a column, and intersects the result with
+    a selection bitmap.
+    \param column The values of the column.
+    \param size The number of rows.
+    \param test The predicate.
+    \param bitmap The selection bitmap, with a word for every \c block rows.
+    \param first \c true if \c bitmap is to be overwritten rather than
+    intersected.
+  */
+  template <typename etype, typename ptype> static inline void scan(const etype * column, size_t size, const ptype & test, uint64_t * bitmap, bool first);
+
+  /**
+    \brief Copies the selected rows of a column.
+    \param column The values of the column.
+    \param size The number of rows.
+    \param bitmap The selection bitmap.
+    \param target The vector to fill, already resized to the number of
+    selected rows.
+  */
+  template <typename etype> static inline void compact(const etype * column, size_t size, const uint64_t * bitmap, etype * target);
+};
+
+namespace ngc
+{
+  template <typename type> class query;
+
+  /**
+    \class soa
+    \brief Stores introspected objects as a structure of arrays.
+
+    Template class \c soa stores a \c std \c :: \c vector for each member of
+    \c type, in order of declaration. The members of the base classes of
+    \c type are not stored. Columns can be accessed by name, but must not be
+    resized: all the columns always have \c size elements.
+
+    \param type The introspected class of the objects.
+
+    \author agent [agent@local]
+    \version 0.0.1
+    \date Oct 17, 2026
+  */
+  template <typename type> class soa
+  {
+    static_assert(__ngc_is_introspected__ <type> :: value, "Only introspected classes can be stored as a structure of arrays.");
+
+    template <typename> friend class query;
+
+    typename __ngc_query__ :: columns <type> :: type columns; /**< The columns, one for each member of \c type. */
+    size_t rows; /**< The number of stored objects. */
+
+  public:
+
+    /**
+      \brief Constructs an empty \c soa.
+    */
+    soa();
+
+    /**
+      \brief Returns the number of stored objects.
+    */
+    inline size_t size() const;
+
+    /**
+      \brief Returns the column of a member.
+      \param name The name of the member, e.g., \c `price`.
+      \return The \c std \c :: \c vector of the values of the member.
+    */
+    template <char... chars> inline auto & operator [] (string <chars...> name);
+
+    /**
+      \brief Returns the column of a member.
+      \param name The name of the member, e.g., \c `price`.
+      \return The \c std \c :: \c vector of the values of the member.
+    */
+    template <char... chars> inline const auto & operator [] (string <chars...> name) const;
+
+    /**
+      \brief Reserves memory for \c size objects in every column.
+    */
+    inline void reserve(size_t size);
+
+    /**
+      \brief Removes all the stored objects.
+    */
+    inline void clear();
+
+    /**
+      \brief Appends an object, copying each of its members to its column.
+    */
+    inline void push_back(const type & that);
+
+    /**
+      \brief Selects the rows whose value of a member satisfies a predicate.
+      \param name The name of the member, e.g., \c `price`.
+      \param test The predicate, e.g., \c ngc \c :: \c gt(100), or any callable
+      that takes a value of the member and returns \c bool.
+      \return A \c query with the selected rows.
+    */
+    template <char... chars, typename ptype> inline query <type> where(string <chars...> name, const ptype & test) const;
+
+  private:
+
+    /**
+      \brief Service overload of \c push_back that iterates on the members.
+    */
+    template <size_t... indexes> inline void push_back(const type & that, __ngc_index_pack__ <indexes...>);
+  };
+
+  /**
+    \class query
+    \brief A selection of the rows of a \c soa.
+
+    A \c query stores a selection bitmap with a bit for each row of the
+    \c soa it was created from, and a reference to it: the \c soa must
+    outlive the \c query, and must not be modified while the \c query is
+    used.
+
+    \param type The introspected class of the objects.
+
+    \author agent [agent@local]
+    \version 0.0.1
+    \date Oct 17, 2026
+  */
+  template <typename type> class query
+  {
+    template <typename> friend class soa;
+
+    const soa <type> * source; /**< The \c soa the rows are selected from. */
+    std :: vector <uint64_t> words; /**< The selection bitmap. */
+
+    /**
+      \brief Constructs a \c query that selects all the rows of a \c soa.
+    */
+    query(const soa <type> & source);
+
+  public:
+
+    /**
+      \brief Returns the selection bitmap, whose bit \c i \c % \c 64 of word
+      \c i \c / \c 64 is set if and only if row \c i is selected.
+    */
+    inline const std :: vector <uint64_t> & bitmap() const;
+
+    /**
+      \brief Returns the number of selected rows.
+    */
+    inline size_t count() const;
+
+    /**
+      \brief Further restricts the selection to the rows whose value of a
+      member satisfies a predicate.
+      \param name The name of the member, e.g., \c `qty`.
+      \param test The predicate.
+      \return A reference to this \c query.
+    */
+    template <char... chars, typename ptype> inline query & where(string <chars...> name, const ptype & test);
+
+    /**
+      \brief Copies the selected rows of some columns.
+      \param names The names of the members, e.g., \c `id`, \c `qty`.
+      \return A \c std \c :: \c tuple with a \c std \c :: \c vector for each
+      member, containing the values of the selected rows in order.
+    */
+    template <typename... ntypes> inline auto select(ntypes... names) const;
+  };
+
+  /**
+    \fn lt
+    \brief Returns a predicate that is \c true for values less than \c value.
+  */
+  template <typename vtype> inline __ngc_query__ :: predicate <__ngc_query__ :: less, vtype> lt(vtype value);
+
+  /**
+    \fn le
+    \brief Returns a predicate that is \c true for values less than or equal
+    to \c value.
+  */
+  template <typename vtype> inline __ngc_query__ :: predicate <__ngc_query__ :: less_equal, vtype> le(vtype value);
+
+  /**
+    \fn gt
+    \brief Returns a predicate that is \c true for values greater than
+    \c value.
+  */
+  template <typename vtype> inline __ngc_query__ :: predicate <__ngc_query__ :: greater, vtype> gt(vtype value);
+
+  /**
+    \fn ge
+    \brief Returns a predicate that is \c true for values greater than or
+    equal to \c value.
+  */
+  template <typename vtype> inline __ngc_query__ :: predicate <__ngc_query__ :: greater_equal, vtype> ge(vtype value);
+
+  /**
+    \fn eq
+    \brief Returns a predicate that is \c true for values equal to \c value.
+  */
+  template <typename vtype> inline __ngc_query__ :: predicate <__ngc_query__ :: equal, vtype> eq(vtype value);
+
+  /**
+    \fn ne
+    \brief Returns a predicate that is \c true for values not equal to
+    \c value.
+  */
+  template <typename vtype> inline __ngc_query__ :: predicate <__ngc_query__ :: not_equal, vtype> ne(vtype value);
+};
+
+#endif
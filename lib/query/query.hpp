@@ -0,0 +1,347 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+*/
+
+#ifndef __lib__query__query__hpp
+#define __lib__query__query__hpp
+
+#if defined(__SSE2__) && defined(__GNUG__)
+#include <emmintrin.h>
+#endif
+
+template <__ngc_query__ :: comparison op, typename vtype> template <typename etype> inline bool __ngc_query__ :: predicate <op, vtype> :: operator () (const etype & that) const
+{
+  if constexpr(std :: is_arithmetic <etype> :: value && std :: is_arithmetic <vtype> :: value && !(std :: is_same <etype, vtype> :: value))
+  {
+    typedef typename std :: common_type <etype, vtype> :: type ctype;
+    return predicate <op, ctype> {static_cast <ctype> (this->value)} (static_cast <ctype> (that));
+  }
+  else if constexpr(op == less)
+    return that < this->value;
+  else if constexpr(op == less_equal)
+    return that <= this->value;
+  else if constexpr(op == greater)
+    return that > this->value;
+  else if constexpr(op == greater_equal)
+    return that >= this->value;
+  else if constexpr(op == equal)
+    return that == this->value;
+  else
+    return that != this->value;
+}
+
+template <typename etype, typename ptype> inline const ptype & __ngc_query__ :: bind(const ptype & test)
+{
+  return test;
+}
+
+template <typename etype, __ngc_query__ :: comparison op, typename vtype, typename std :: enable_if <std :: is_arithmetic <etype> :: value && std :: is_arithmetic <vtype> :: value> :: type *> inline __ngc_query__ :: predicate <op, typename std :: common_type <etype, vtype> :: type> __ngc_query__ :: bind(const predicate <op, vtype> & test)
+{
+  return {static_cast <typename std :: common_type <etype, vtype> :: type> (test.value)};
+}
+
+inline size_t __ngc_query__ :: popcount(uint64_t word)
+{
+#if defined(__GNUG__)
+  return __builtin_popcountll(word);
+#else
+  size_t count = 0;
+
+  for(; word; word &= word - 1)
+    count++;
+
+  return count;
+#endif
+}
+
+inline size_t __ngc_query__ :: lowest(uint64_t word)
+{
+#if defined(__GNUG__)
+  return __builtin_ctzll(word);
+#else
+  size_t index = 0;
+
+  for(; !(word & 1); word >>= 1)
+    index++;
+
+  return index;
+#endif
+}
+
+inline uint64_t __ngc_query__ :: pack(const uint8_t * flags)
+{
+  uint64_t word = 0;
+
+#if defined(__SSE2__) && defined(__GNUG__)
+  for(size_t i = 0; i < block; i += 16)
+    word |= (uint64_t) (uint32_t) _mm_movemask_epi8(_mm_load_si128((const __m128i *) (flags + i))) << i;
+#else
+  for(size_t i = 0; i < block; i++)
+    word |= (uint64_t) (flags[i] & 1) << i;
+#endif
+
+  return word;
+}
+
+#if defined(__SSE2__) && defined(__GNUG__)
+template <__ngc_query__ :: comparison op, typename vtype, typename etype> inline uint64_t __ngc_query__ :: kernel(const etype * values, const predicate <op, vtype> & test)
+{
+  uint64_t word = 0;
+
+  if constexpr(std :: is_same <etype, double> :: value)
+  {
+    const __m128d value = _mm_set1_pd(test.value);
+
+    for(size_t i = 0; i < block; i += 2)
+    {
+      __m128d item = _mm_loadu_pd(values + i);
+      __m128d mask;
+
+      if constexpr(op == less) mask = _mm_cmplt_pd(item, value);
+      else if constexpr(op == less_equal) mask = _mm_cmple_pd(item, value);
+      else if constexpr(op == greater) mask = _mm_cmpgt_pd(item, value);
+      else if constexpr(op == greater_equal) mask = _mm_cmpge_pd(item, value);
+      else if constexpr(op == equal) mask = _mm_cmpeq_pd(item, value);
+      else mask = _mm_cmpneq_pd(item, value);
+
+      word |= (uint64_t) _mm_movemask_pd(mask) << i;
+    }
+  }
+  else if constexpr(std :: is_same <etype, float> :: value)
+  {
+    const __m128 value = _mm_set1_ps(test.value);
+
+    for(size_t i = 0; i < block; i += 4)
+    {
+      __m128 item = _mm_loadu_ps(values + i);
+      __m128 mask;
+
+      if constexpr(op == less) mask = _mm_cmplt_ps(item, value);
+      else if constexpr(op == less_equal) mask = _mm_cmple_ps(item, value);
+      else if constexpr(op == greater) mask = _mm_cmpgt_ps(item, value);
+      else if constexpr(op == greater_equal) mask = _mm_cmpge_ps(item, value);
+      else if constexpr(op == equal) mask = _mm_cmpeq_ps(item, value);
+      else mask = _mm_cmpneq_ps(item, value);
+
+      word |= (uint64_t) _mm_movemask_ps(mask) << i;
+    }
+  }
+  else
+  {
+    // SSE2 only compares signed integers: unsigned integers are compared with their sign bit flipped.
+    const __m128i flip = _mm_set1_epi32(std :: is_same <etype, uint32_t> :: value ? (int32_t) 0x80000000 : 0);
+    const __m128i value = _mm_xor_si128(_mm_set1_epi32((int32_t) test.value), flip);
+
+    for(size_t i = 0; i < block; i += 4)
+    {
+      __m128i item = _mm_xor_si128(_mm_loadu_si128((const __m128i *) (values + i)), flip);
+      __m128i mask;
+
+      if constexpr(op == less || op == greater_equal)
+        mask = _mm_cmplt_epi32(item, value);
+      else if constexpr(op == greater || op == less_equal)
+        mask = _mm_cmpgt_epi32(item, value);
+      else
+        mask = _mm_cmpeq_epi32(item, value);
+
+      uint64_t bits = (uint64_t) _mm_movemask_ps(_mm_castsi128_ps(mask));
+
+      if constexpr(op == greater_equal || op == less_equal || op == not_equal)
+        bits ^= 0xf;
+
+      word |= bits << i;
+    }
+  }
+
+  return word;
+}
+#endif
+
+template <typename etype, typename ptype> inline void __ngc_query__ :: scan(const etype * column, size_t size, const ptype & test, uint64_t * bitmap, bool first)
+{
+  const auto & bound = bind <etype> (test);
+
+  alignas(16) uint8_t flags[block];
+
+  for(size_t offset = 0, word = 0; offset < size; offset += block, word++)
+  {
+    if(!first && !bitmap[word])
+      continue;
+
+    uint64_t result = 0;
+
+    if(size - offset >= block)
+    {
+      const etype * values = column + offset;
+
+      if constexpr(simd <typename std :: decay <decltype(bound)> :: type, etype> :: value)
+        result = kernel(values, bound);
+      else
+      {
+        for(size_t i = 0; i < block; i++)
+          flags[i] = bound(values[i]) ? 0xff : 0x00;
+
+        result = pack(flags);
+      }
+    }
+    else
+      for(size_t i = 0; i < size - offset; i++)
+        result |= (uint64_t) bound(column[offset + i]) << i;
+
+    bitmap[word] = first ? result : (bitmap[word] & result);
+  }
+}
+
+template <typename etype> inline void __ngc_query__ :: compact(const etype * column, size_t size, const uint64_t * bitmap, etype * target)
+{
+  for(size_t offset = 0, word = 0; offset < size; offset += block, word++)
+  {
+    uint64_t bits = bitmap[word];
+
+    if(bits == ~(uint64_t) 0)
+      for(size_t i = 0; i < block; i++)
+        *(target++) = column[offset + i];
+    else
+      for(; bits; bits &= bits - 1)
+        *(target++) = column[offset + lowest(bits)];
+  }
+}
+
+namespace ngc
+{
+  template <typename type> soa <type> :: soa() : rows(0)
+  {
+  }
+
+  template <typename type> inline size_t soa <type> :: size() const
+  {
+    return this->rows;
+  }
+
+  template <typename type> template <char... chars> inline auto & soa <type> :: operator [] (string <chars...>)
+  {
+    return std :: get <__ngc_member_index__ <type, string <chars...>> :: value> (this->columns);
+  }
+
+  template <typename type> template <char... chars> inline const auto & soa <type> :: operator [] (string <chars...>) const
+  {
+    return std :: get <__ngc_member_index__ <type, string <chars...>> :: value> (this->columns);
+  }
+
+  template <typename type> inline void soa <type> :: reserve(size_t size)
+  {
+    std :: apply([&](auto & ... columns)
+    {
+      (columns.reserve(size), ...);
+    }, this->columns);
+  }
+
+  template <typename type> inline void soa <type> :: clear()
+  {
+    std :: apply([](auto & ... columns)
+    {
+      (columns.clear(), ...);
+    }, this->columns);
+
+    this->rows = 0;
+  }
+
+  template <typename type> inline void soa <type> :: push_back(const type & that)
+  {
+    this->push_back(that, typename __ngc_make_index_pack__ <__ngc_member_count__ <type> :: value> :: type {});
+    this->rows++;
+  }
+
+  template <typename type> template <size_t... indexes> inline void soa <type> :: push_back(const type & that, __ngc_index_pack__ <indexes...>)
+  {
+    (std :: get <indexes> (this->columns).push_back(type :: template __ngc_member__ <indexes, false> :: get(that)), ...);
+  }
+
+  template <typename type> template <char... chars, typename ptype> inline query <type> soa <type> :: where(string <chars...> name, const ptype & test) const
+  {
+    query <type> result(*this);
+    result.where(name, test);
+    return result;
+  }
+
+  template <typename type> query <type> :: query(const soa <type> & source) : source(&source), words((source.rows + __ngc_query__ :: block - 1) / __ngc_query__ :: block, ~(uint64_t) 0)
+  {
+    if(source.rows % __ngc_query__ :: block)
+      this->words.back() = ((uint64_t) 1 << (source.rows % __ngc_query__ :: block)) - 1;
+  }
+
+  template <typename type> inline const std :: vector <uint64_t> & query <type> :: bitmap() const
+  {
+    return this->words;
+  }
+
+  template <typename type> inline size_t query <type> :: count() const
+  {
+    size_t count = 0;
+
+    for(uint64_t word : this->words)
+      count += __ngc_query__ :: popcount(word);
+
+    return count;
+  }
+
+  template <typename type> template <char... chars, typename ptype> inline query <type> & query <type> :: where(string <chars...> name, const ptype & test)
+  {
+    const auto & column = (*(this->source))[name];
+    __ngc_query__ :: scan(column.data(), column.size(), test, this->words.data(), false);
+
+    return (*this);
+  }
+
+  template <typename type> template <typename... ntypes> inline auto query <type> :: select(ntypes... names) const
+  {
+    size_t count = this->count();
+
+    auto result = std :: make_tuple(std :: remove_cv_t <std :: remove_reference_t <decltype((*(this->source))[names])>> (count)...);
+
+    std :: apply([&](auto & ... targets)
+    {
+      (__ngc_query__ :: compact((*(this->source))[names].data(), this->source->rows, this->words.data(), targets.data()), ...);
+    }, result);
+
+    return result;
+  }
+
+  template <typename vtype> inline __ngc_query__ :: predicate <__ngc_query__ :: less, vtype> lt(vtype value)
+  {
+    return {value};
+  }
+
+  template <typename vtype> inline __ngc_query__ :: predicate <__ngc_query__ :: less_equal, vtype> le(vtype value)
+  {
+    return {value};
+  }
+
+  template <typename vtype> inline __ngc_query__ :: predicate <__ngc_query__ :: greater, vtype> gt(vtype value)
+  {
+    return {value};
+  }
+
+  template <typename vtype> inline __ngc_query__ :: predicate <__ngc_query__ :: greater_equal, vtype> ge(vtype value)
+  {
+    return {value};
+  }
+
+  template <typename vtype> inline __ngc_query__ :: predicate <__ngc_query__ :: equal, vtype> eq(vtype value)
+  {
+    return {value};
+  }
+
+  template <typename vtype> inline __ngc_query__ :: predicate <__ngc_query__ :: not_equal, vtype> ne(vtype value)
+  {
+    return {value};
+  }
+};
+
+#endif
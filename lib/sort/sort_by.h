@@ -0,0 +1,313 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file sort_by.h
+
+  This file includes the declaration of \c sort_by, \c sorted_indices,
+  \c index_by and \c sorted_index in namespace \c ngc, and of their service
+  class \c __ngc_sort__.
+
+  Records, i.e., objects of an introspected class, are sorted by the value of
+  one of their members, named at compile time by its \c ngc \c :: \c string
+  name. Integral, enumeration, \c float and \c double keys are sorted with an
+  LSD radix sort, any other key with a comparison sort.
+
+  \code
+  class trade
+  {
+  public:
+    uint64_t id;
+    double price;
+  };
+
+  // After parser parses trade ..
+
+  std :: vector <trade> trades;
+
+  ngc :: sort_by(trades, `price`); // Sorts trades in place, by price.
+  std :: vector <size_t> order = ngc :: sorted_indices(trades, `id`); // trades[order[0]] has the smallest id.
+
+  auto index = ngc :: index_by(trades, `id`);
+  size_t rank = index.lower_bound(42); // index.position(rank) is the position in trades of the first trade with id not less than 42.
+  \endcode
+
+  \see reference/sort/reference.md
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __lib__sort__sort_by__h
+#define __lib__sort__sort_by__h
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../introspection/__ngc_member_index__.h"
+#include "../string/string.h"
+
+/**
+  \class __ngc_sort__
+  \brief Service class for \c ngc \c :: \c sort_by, \c ngc \c :: \c sorted_indices
+  and \c ngc \c :: \c index_by that computes the order of records by key.
+
+  Keys that can be radix sorted are first encoded as unsigned integers of the
+  same size, whose order as unsigned integers is the order of the keys. The
+  encoded keys are then sorted, together with the positions of their
+  records, one byte at a time, starting from the least significant. The
+  histograms of all bytes are computed in a single pass, and bytes that have
+  the same value in every key are skipped. Every other byte takes one pass,
+  that scatters the (key, position) pairs into a second buffer.
+
+  Positions are 32 bit integers if there are fewer than 2^32 records, to
+  halve the memory moved by each pass for 32 bit keys.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+struct __ngc_sort__
+{
+  static constexpr size_t threshold = 256; /**< Below this number of records, keys are sorted with a comparison sort. */
+
+  /**
+    \class radixable
+    \brief Determines if keys of type \c ktype can be radix sorted.
+  */
+  template <typename ktype> struct radixable : std :: integral_constant <bool, std :: is_integral <ktype> :: value || std :: is_enum <ktype> :: value || std :: is_same <ktype, float> :: value || std :: is_same <ktype, double> :: value>
+  {
+  };
+
+  /**
+    \class encoding
+    \brief Provides, as \c type, the unsigned integer type that keys of type
+    \c ktype are encoded into.
+  */
+  template <typename ktype, size_t size = sizeof(ktype)> struct encoding;
+
+  template <typename ktype> struct encoding <ktype, 1>
+  {
+    typedef uint8_t type;
+  };
+
+  template <typename ktype> struct encoding <ktype, 2>
+  {
+    typedef uint16_t type;
+  };
+
+  template <typename ktype> struct encoding <ktype, 4>
+  {
+    typedef uint32_t type;
+  };
+
+  template <typename ktype> struct encoding <ktype, 8>
+  {
+    typedef uint64_t type;
+  };
+
+  /**
+    \class item
+    \brief An encoded key and the position of its record.
+  */
+  template <typename utype, typename itype> struct item
+  {
+    utype key; /**< The encoded key. */
+    itype index; /**< The position of the record. */
+  };
+
+  /**
+    \class record
+    \brief Provides, as \c type, the type of the records in a range.
+  */
+  template <typename rtype> struct record
+  {
+    typedef typename std :: remove_cv <typename std :: remove_reference <decltype(* std :: begin(std :: declval <rtype &> ()))> :: type> :: type type;
+  };
+
+  /**
+    \class field
+    \brief Provides, as \c type, the type of the member named \c name of
+    records of type \c otype.
+  */
+  template <typename otype, typename name> struct field
+  {
+    typedef typename otype :: template __ngc_member__ <__ngc_member_index__ <otype, name> :: value, false> :: type type;
+  };
+
+  /**
+    \brief Returns the member named \c name of a record.
+  */
+  template <typename name, typename type> static inline const typename field <type, name> :: type & get(const type & that);
+
+  /**
+    \brief Encodes a key as an unsigned integer with the same order.
+
+    Unsigned integers are unchanged. Signed integers have their sign bit
+    flipped. Non-negative floating point numbers have their sign bit flipped,
+    negative ones have all their bits flipped. Negative zero is encoded as
+    zero.
+  */
+  template <typename ktype> static inline typename encoding <ktype> :: type encode(ktype that);
+
+  /**
+    \brief Sorts items by key, with an LSD radix sort.
+    \param items The items.
+    \param buffer A buffer for as many items.
+    \param size The number of items.
+    \return A pointer to the sorted items, either \c items or \c buffer.
+  */
+  template <typename utype, typename itype> static inline item <utype, itype> * radix(item <utype, itype> * items, item <utype, itype> * buffer, size_t size);
+
+  /**
+    \brief Computes the order of records by the member named \c name.
+
+    Positions are sorted as \c itype integers, and written to the result as
+    \c otype integers, so that a narrow \c itype can be sorted into a wide
+    result with no further copy.
+
+    \param records The records.
+    \return The positions of the records, in order of key. Records with
+    equal keys keep their relative order.
+  */
+  template <typename name, typename itype, typename otype, typename rtype> static inline std :: vector <otype> order(const rtype & records);
+
+  /**
+    \brief Permutes records, by moving them in order to a buffer and back.
+
+    The records are read in random order but independently, so that the
+    memory accesses overlap. If the buffer cannot be allocated, the records
+    are permuted with \c cycles instead.
+
+    \param records The records.
+    \param order The position of the record that goes to each position.
+    Possibly clobbered.
+  */
+  template <typename rtype, typename itype> static inline void permute(rtype & records, std :: vector <itype> & order);
+
+  /**
+    \brief Permutes records in place, following each cycle of a permutation.
+    Needs no memory other than one record, but each step of a cycle depends
+    on the random access of the previous one.
+    \param records The records.
+    \param order The position of the record that goes to each position.
+    Clobbered.
+  */
+  template <typename rtype, typename itype> static inline void cycles(rtype & records, std :: vector <itype> & order);
+};
+
+namespace ngc
+{
+  /**
+    \class sorted_index
+    \brief A secondary index on records, sorted by key.
+
+    A \c sorted_index stores the keys of records in order, and the position
+    of the record each key belongs to, so that records can be looked up by
+    key with a binary search, or with an interpolation search for arithmetic
+    keys. Ranks are positions in the \c sorted_index, from \c 0 for the
+    smallest key to \c size() \c - \c 1 for the largest.
+
+    \param ktype The type of the keys.
+
+    \author agent [agent@local]
+    \version 0.0.1
+    \date Oct 17, 2026
+  */
+  template <typename ktype> class sorted_index
+  {
+    std :: vector <ktype> keys; /**< The keys, sorted. */
+    std :: vector <size_t> positions; /**< The position of the record of each key. */
+
+  public:
+
+    /**
+      \brief Constructs a \c sorted_index from sorted keys and the positions
+      of their records. Use \c ngc \c :: \c index_by to build one.
+    */
+    sorted_index(std :: vector <ktype> keys, std :: vector <size_t> positions);
+
+    /**
+      \brief Returns the number of keys.
+    */
+    inline size_t size() const;
+
+    /**
+      \brief Returns the key with a given rank.
+    */
+    inline const ktype & key(size_t rank) const;
+
+    /**
+      \brief Returns the position of the record of the key with a given rank.
+    */
+    inline size_t position(size_t rank) const;
+
+    /**
+      \brief Returns the rank of the first key not less than \c that, or
+      \c size() if none, with a binary search.
+    */
+    inline size_t lower_bound(const ktype & that) const;
+
+    /**
+      \brief Returns the rank of the first key greater than \c that, or
+      \c size() if none, with a binary search.
+    */
+    inline size_t upper_bound(const ktype & that) const;
+
+    /**
+      \brief Returns the rank of the first key not less than \c that, or
+      \c size() if none, with an interpolation search.
+
+      Each step estimates the rank of \c that by linear interpolation between
+      the smallest and largest keys left, which takes O(log log n) steps on
+      uniformly distributed keys. After a bounded number of steps, or when
+      few keys are left, the search falls back on a binary search, so that
+      skewed keys take O(log n) steps at worst. Only available for arithmetic
+      keys.
+    */
+    inline size_t interpolate(const ktype & that) const;
+  };
+
+  /**
+    \fn sort_by
+    \brief Sorts records in place by the value of one of their members.
+    Records with equal keys keep their relative order.
+    \param records A random access range of records, e.g., a
+    \c std \c :: \c vector.
+    \param name The name of the member, e.g., \c `price`.
+  */
+  template <typename rtype, char... chars> inline void sort_by(rtype & records, string <chars...> name);
+
+  /**
+    \fn sorted_indices
+    \brief Returns the positions of records in order of the value of one of
+    their members, without moving them. Records with equal keys keep their
+    relative order.
+    \param records A random access range of records.
+    \param name The name of the member, e.g., \c `id`.
+  */
+  template <typename rtype, char... chars> inline std :: vector <size_t> sorted_indices(const rtype & records, string <chars...> name);
+
+  /**
+    \fn index_by
+    \brief Builds a \c sorted_index on the value of one of the members of
+    records.
+    \param records A random access range of records.
+    \param name The name of the member, e.g., \c `id`.
+  */
+  template <typename rtype, char... chars> inline auto index_by(const rtype & records, string <chars...> name);
+};
+
+#endif
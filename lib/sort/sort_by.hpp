@@ -0,0 +1,282 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+*/
+
+#ifndef __lib__sort__sort_by__hpp
+#define __lib__sort__sort_by__hpp
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
+
+template <typename name, typename type> inline const typename __ngc_sort__ :: field <type, name> :: type & __ngc_sort__ :: get(const type & that)
+{
+  return type :: template __ngc_member__ <__ngc_member_index__ <type, name> :: value, false> :: get(that);
+}
+
+template <typename ktype> inline typename __ngc_sort__ :: encoding <ktype> :: type __ngc_sort__ :: encode(ktype that)
+{
+  typedef typename encoding <ktype> :: type utype;
+
+  constexpr utype sign = (utype) ((utype) 1 << (sizeof(utype) * 8 - 1));
+
+  if constexpr(std :: is_enum <ktype> :: value)
+    return encode(static_cast <typename std :: underlying_type <ktype> :: type> (that));
+  else if constexpr(std :: is_floating_point <ktype> :: value)
+  {
+    if(that == 0)
+      that = 0; // Negative zero compares equal to zero, and must not be sorted before it.
+
+    utype bits;
+    std :: memcpy(&bits, &that, sizeof(utype));
+
+    return (bits & sign) ? (utype) ~bits : (utype) (bits | sign);
+  }
+  else if constexpr(std :: is_signed <ktype> :: value)
+    return (utype) ((utype) that ^ sign);
+  else
+    return (utype) that;
+}
+
+template <typename utype, typename itype> inline __ngc_sort__ :: item <utype, itype> * __ngc_sort__ :: radix(item <utype, itype> * items, item <utype, itype> * buffer, size_t size)
+{
+  constexpr size_t digits = sizeof(utype);
+
+  size_t counts[digits][256] = {};
+
+  for(size_t i = 0; i < size; i++)
+    for(size_t digit = 0; digit < digits; digit++)
+      counts[digit][(items[i].key >> (digit * 8)) & 0xff]++;
+
+  for(size_t digit = 0; digit < digits; digit++)
+  {
+    if(counts[digit][(items[0].key >> (digit * 8)) & 0xff] == size)
+      continue;
+
+    size_t offsets[256];
+
+    for(size_t value = 0, offset = 0; value < 256; value++)
+    {
+      offsets[value] = offset;
+      offset += counts[digit][value];
+    }
+
+    for(size_t i = 0; i < size; i++)
+      buffer[offsets[(items[i].key >> (digit * 8)) & 0xff]++] = items[i];
+
+    std :: swap(items, buffer);
+  }
+
+  return items;
+}
+
+template <typename name, typename itype, typename otype, typename rtype> inline std :: vector <otype> __ngc_sort__ :: order(const rtype & records)
+{
+  typedef typename record <rtype> :: type type;
+  typedef typename field <type, name> :: type ktype;
+
+  auto begin = std :: begin(records);
+  size_t size = std :: end(records) - begin;
+
+  std :: vector <otype> result(size);
+
+  if constexpr(radixable <ktype> :: value)
+  {
+    typedef item <typename encoding <ktype> :: type, itype> element;
+
+    std :: unique_ptr <element []> items(new element[size]);
+    std :: unique_ptr <element []> buffer;
+
+    for(size_t i = 0; i < size; i++)
+      items[i] = {encode(get <name> (begin[i])), (itype) i};
+
+    element * sorted = items.get();
+
+    if(size < threshold)
+      std :: stable_sort(items.get(), items.get() + size, [](const element & left, const element & right)
+      {
+        return left.key < right.key;
+      });
+    else
+    {
+      buffer.reset(new element[size]);
+      sorted = radix(items.get(), buffer.get(), size);
+    }
+
+    for(size_t i = 0; i < size; i++)
+      result[i] = sorted[i].index;
+  }
+  else
+  {
+    for(size_t i = 0; i < size; i++)
+      result[i] = (otype) i;
+
+    std :: stable_sort(result.begin(), result.end(), [&](otype left, otype right)
+    {
+      return get <name> (begin[left]) < get <name> (begin[right]);
+    });
+  }
+
+  return result;
+}
+
+template <typename rtype, typename itype> inline void __ngc_sort__ :: permute(rtype & records, std :: vector <itype> & order)
+{
+  typedef typename record <rtype> :: type type;
+
+  auto begin = std :: begin(records);
+  std :: vector <type> buffer;
+
+  try
+  {
+    buffer.reserve(order.size());
+  }
+  catch(const std :: bad_alloc &)
+  {
+    cycles(records, order);
+    return;
+  }
+
+  for(size_t i = 0; i < order.size(); i++)
+    buffer.push_back(std :: move(begin[order[i]]));
+
+  std :: move(buffer.begin(), buffer.end(), begin);
+}
+
+template <typename rtype, typename itype> inline void __ngc_sort__ :: cycles(rtype & records, std :: vector <itype> & order)
+{
+  auto begin = std :: begin(records);
+
+  for(size_t start = 0; start < order.size(); start++)
+  {
+    if(order[start] == start)
+      continue;
+
+    auto value = std :: move(begin[start]);
+    size_t position = start;
+
+    while(order[position] != start)
+    {
+      size_t next = order[position];
+
+      begin[position] = std :: move(begin[next]);
+      order[position] = (itype) position;
+      position = next;
+    }
+
+    begin[position] = std :: move(value);
+    order[position] = (itype) position;
+  }
+}
+
+namespace ngc
+{
+  template <typename ktype> sorted_index <ktype> :: sorted_index(std :: vector <ktype> keys, std :: vector <size_t> positions) : keys(std :: move(keys)), positions(std :: move(positions))
+  {
+  }
+
+  template <typename ktype> inline size_t sorted_index <ktype> :: size() const
+  {
+    return this->keys.size();
+  }
+
+  template <typename ktype> inline const ktype & sorted_index <ktype> :: key(size_t rank) const
+  {
+    return this->keys[rank];
+  }
+
+  template <typename ktype> inline size_t sorted_index <ktype> :: position(size_t rank) const
+  {
+    return this->positions[rank];
+  }
+
+  template <typename ktype> inline size_t sorted_index <ktype> :: lower_bound(const ktype & that) const
+  {
+    return std :: lower_bound(this->keys.begin(), this->keys.end(), that) - this->keys.begin();
+  }
+
+  template <typename ktype> inline size_t sorted_index <ktype> :: upper_bound(const ktype & that) const
+  {
+    return std :: upper_bound(this->keys.begin(), this->keys.end(), that) - this->keys.begin();
+  }
+
+  template <typename ktype> inline size_t sorted_index <ktype> :: interpolate(const ktype & that) const
+  {
+    static_assert(std :: is_arithmetic <ktype> :: value, "Interpolation search is only available for arithmetic keys.");
+
+    size_t low = 0;
+    size_t high = this->keys.size();
+
+    for(size_t step = 0; step < 32 && high - low > 8; step++)
+    {
+      const ktype & first = this->keys[low];
+      const ktype & last = this->keys[high - 1];
+
+      if(!(first < that))
+        return low;
+
+      if(last < that)
+        return high;
+
+      double fraction = ((double) that - (double) first) / ((double) last - (double) first);
+      size_t probe = std :: min(low + (size_t) (fraction * (double) (high - 1 - low)), high - 1);
+
+      if(this->keys[probe] < that)
+        low = probe + 1;
+      else
+        high = probe;
+    }
+
+    return std :: lower_bound(this->keys.begin() + low, this->keys.begin() + high, that) - this->keys.begin();
+  }
+
+  template <typename rtype, char... chars> inline void sort_by(rtype & records, string <chars...>)
+  {
+    size_t size = std :: end(records) - std :: begin(records);
+
+    if(size <= UINT32_MAX)
+    {
+      std :: vector <uint32_t> order = __ngc_sort__ :: order <string <chars...>, uint32_t, uint32_t> (records);
+      __ngc_sort__ :: permute(records, order);
+    }
+    else
+    {
+      std :: vector <size_t> order = __ngc_sort__ :: order <string <chars...>, size_t, size_t> (records);
+      __ngc_sort__ :: permute(records, order);
+    }
+  }
+
+  template <typename rtype, char... chars> inline std :: vector <size_t> sorted_indices(const rtype & records, string <chars...>)
+  {
+    size_t size = std :: end(records) - std :: begin(records);
+
+    if(size <= UINT32_MAX)
+      return __ngc_sort__ :: order <string <chars...>, uint32_t, size_t> (records);
+    else
+      return __ngc_sort__ :: order <string <chars...>, size_t, size_t> (records);
+  }
+
+  template <typename rtype, char... chars> inline auto index_by(const rtype & records, string <chars...> name)
+  {
+    typedef typename __ngc_sort__ :: field <typename __ngc_sort__ :: record <rtype> :: type, string <chars...>> :: type ktype;
+
+    std :: vector <size_t> positions = sorted_indices(records, name);
+    std :: vector <ktype> keys(positions.size());
+
+    auto begin = std :: begin(records);
+
+    for(size_t rank = 0; rank < positions.size(); rank++)
+      keys[rank] = __ngc_sort__ :: get <string <chars...>> (begin[positions[rank]]);
+
+    return sorted_index <ktype> (std :: move(keys), std :: move(positions));
+  }
+};
+
+#endif
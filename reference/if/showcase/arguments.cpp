@@ -8,10 +8,6 @@ template <bool __ngc_0_dummy__> struct __ngc_container__ <0, __ngc_0_dummy__>
 {
   struct __ngc_conditional_true__
   {
-    /* __ngc_conditional_true__ container declaration point */
-
-    template <unsigned long, bool> struct __ngc_container__;
-
     /* __ngc_conditional_true__ code */
 
     template <bool condition> static inline void execute(int & n, const int & k, int & j)
@@ -24,10 +20,6 @@ template <bool __ngc_0_dummy__> struct __ngc_container__ <0, __ngc_0_dummy__>
 
   struct __ngc_conditional_false__
   {
-    /* __ngc_conditional_false__ container declaration point */
-
-    template <unsigned long, bool> struct __ngc_container__;
-
     /* __ngc_conditional_false__ code */
 
     template <bool condition> static inline void execute(int & n, const int & k, int & j)
@@ -12,10 +12,6 @@ template <bool __ngc_0_dummy__> struct __ngc_container__ <0, __ngc_0_dummy__>
 {
   struct __ngc_conditional_true__
   {
-    /* __ngc_conditional_true__ container declaration point */
-
-    template <unsigned long, bool> struct __ngc_container__;
-
     /* __ngc_conditional_true__ code */
 
     static inline void execute()
@@ -28,10 +24,6 @@ template <bool __ngc_0_dummy__> struct __ngc_container__ <0, __ngc_0_dummy__>
 
   struct __ngc_conditional_false__
   {
-    /* __ngc_conditional_false__ container declaration point */
-
-    template <unsigned long, bool> struct __ngc_container__;
-
     /* __ngc_conditional_false__ code */
 
     static inline void execute()
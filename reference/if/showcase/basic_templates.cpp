@@ -1,9 +1,3 @@
-/* Global scope container declaration point */
-
-template <unsigned long, bool> struct __ngc_container__;
-
-/* Code */
-
 template <typename type> class c
 {
   /* Class c container declaration point */
@@ -21,10 +15,6 @@ template <typename type> template <bool __ngc_0_dummy__> struct c <type> :: __ng
 {
   struct __ngc_conditional_true__
   {
-    /* __ngc_conditional_true__ container declaration point */
-
-    template <unsigned long, bool> struct __ngc_container__;
-
     /* __ngc_conditional_true__ code */
 
     template <bool condition> static inline void execute()
@@ -37,10 +27,6 @@ template <typename type> template <bool __ngc_0_dummy__> struct c <type> :: __ng
 
   struct __ngc_conditional_false__
   {
-    /* __ngc_conditional_false__ container declaration point */
-
-    template <unsigned long, bool> struct __ngc_container__;
-
     /* __ngc_conditional_false__ code */
 
     template <bool condition> static inline void execute()
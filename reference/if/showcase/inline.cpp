@@ -1,9 +1,3 @@
-/* Global scope container declaration point */
-
-template <unsigned long, bool> struct __ngc_container__;
-
-/* Code */
-
 class c
 {
   /* Class c container declaration point */
@@ -16,10 +10,6 @@ class c
   {
     struct __ngc_conditional_true__
     {
-      /* __ngc_conditional_true__ container declaration point */
-
-      template <unsigned long, bool> struct __ngc_container__;
-
       /* __ngc_conditional_true__ code */
 
       template <bool> static inline void execute()
@@ -32,10 +22,6 @@ class c
 
     struct __ngc_conditional_false__
     {
-      /* __ngc_conditional_false__ container declaration point */
-
-      template <unsigned long, bool> struct __ngc_container__;
-
       /* __ngc_conditional_false__ code */
 
       template <bool> static inline void execute()
@@ -0,0 +1,51 @@
+/* Global scope container declaration point */
+
+template <unsigned long, bool> struct __ngc_container__;
+
+/* Code */
+
+#line 1 "lines.ngc"
+static constexpr bool value = true;
+
+/* Pre-function f container injection point */
+
+#line 5 "lines.ngc"
+template <bool __ngc_0_dummy__> struct __ngc_container__ <0, __ngc_0_dummy__>
+{
+  struct __ngc_conditional_true__
+  {
+    /* __ngc_conditional_true__ code */
+
+    static inline void execute()
+    {
+#line 6 "lines.ngc"
+      {
+        std :: cout << "Value is true." << std :: endl;
+      }
+#line 5 "lines.ngc"
+    }
+  };
+
+  struct __ngc_conditional_false__
+  {
+    /* __ngc_conditional_false__ code */
+
+    static inline void execute()
+    {
+#line 10 "lines.ngc"
+      {
+        std :: cout << "Value if false." << std :: endl;
+      }
+#line 5 "lines.ngc"
+    }
+  };
+};
+
+/* Code */
+
+#line 3 "lines.ngc"
+void f()
+{
+  std :: conditional <value, typename __ngc_container__ <0, false> :: __ngc_conditional_true__, typename __ngc_container__ <0, false> :: __ngc_conditional_false__> :: type :: execute();
+#line 13 "lines.ngc"
+}
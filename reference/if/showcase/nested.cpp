@@ -18,10 +18,6 @@ template <bool __ngc_0_dummy__> struct __ngc_container__ <0, __ngc_0_dummy__>
     {
       struct __ngc_conditional_true__
       {
-        /* __ngc_conditional_true__ container declaration point */
-
-        template <unsigned long, bool> struct __ngc_container__;
-
         /* __ngc_conditional_true__ code*/
 
         template <bool first_condition, bool second_condition> static inline void execute()
@@ -34,10 +30,6 @@ template <bool __ngc_0_dummy__> struct __ngc_container__ <0, __ngc_0_dummy__>
 
       struct __ngc_conditional_false__
       {
-        /* __ngc_conditional_false__ container declaration point */
-
-        template <unsigned long, bool> struct __ngc_container__;
-
         /* __ngc_conditional_false__ code*/
 
         template <bool first_condition, bool second_condition> static inline void execute()
@@ -71,10 +63,6 @@ template <bool __ngc_0_dummy__> struct __ngc_container__ <0, __ngc_0_dummy__>
     {
       struct __ngc_conditional_true__
       {
-        /* __ngc_conditional_true__ container declaration point */
-
-        template <unsigned long, bool> struct __ngc_container__;
-
         /* __ngc_conditional_true__ code */
 
         template <bool first_condition, bool second_condition> static inline void execute()
@@ -87,10 +75,6 @@ template <bool __ngc_0_dummy__> struct __ngc_container__ <0, __ngc_0_dummy__>
 
       struct __ngc_conditional_false__
       {
-        /* __ngc_conditional_false__ container declaration point */
-
-        template <unsigned long, bool> struct __ngc_container__;
-
         /* __ngc_conditional_false__ code */
 
         template <bool first_condition, bool second_condition> static inline void execute()
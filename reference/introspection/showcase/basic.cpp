@@ -2,6 +2,7 @@ class myclass
 {
 public:
 
+    typedef myclass __ngc_introspected__;
     template <size_t, bool> struct __ngc_member__;
 
 private:
@@ -28,12 +29,12 @@ public:
 
 protected:
 
-    inline __ngc_member__ <0, false> :: type & operator [] (__ngc_member__ <0, false> :: name)
+    inline decltype(i) & operator [] (ngc :: string <'i'>)
     {
         return __ngc_member__ <0, false> :: get(*this);
     }
 
-    inline const __ngc_member__ <0, false> :: type & operator [] (__ngc_member__ <0, false> :: name) const
+    inline const decltype(i) & operator [] (ngc :: string <'i'>) const
     {
         return __ngc_member__ <0, false> :: get(*this);
     }
@@ -62,12 +63,12 @@ public:
 
 private:
 
-    inline __ngc_member__ <1, false> :: type & operator [] (__ngc_member__ <1, false> :: name)
+    inline decltype(j) & operator [] (ngc :: string <'j'>)
     {
         return __ngc_member__ <1, false> :: get(*this);
     }
 
-    inline const __ngc_member__ <1, false> :: type & operator [] (__ngc_member__ <1, false> :: name) const
+    inline const decltype(j) & operator [] (ngc :: string <'j'>) const
     {
         return __ngc_member__ <1, false> :: get(*this);
     }
@@ -96,12 +97,12 @@ public:
 
 public:
 
-    inline __ngc_member__ <2, false> :: type & operator [] (__ngc_member__ <2, false> :: name)
+    inline decltype(k) & operator [] (ngc :: string <'k'>)
     {
         return __ngc_member__ <2, false> :: get(*this);
     }
 
-    inline const __ngc_member__ <2, false> :: type & operator [] (__ngc_member__ <2, false> :: name) const
+    inline const decltype(k) & operator [] (ngc :: string <'k'>) const
     {
         return __ngc_member__ <2, false> :: get(*this);
     }
@@ -0,0 +1,50 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file check.h
+
+  This file includes \c NGC_CHECK, the assertion used by the tests. A failed
+  check prints its condition and its position, and is counted: every test
+  returns \c ngc_test \c :: \c result(), i.e., a non-zero status if any of
+  its checks failed.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __test__check__h
+#define __test__check__h
+
+#include <cstdio>
+
+#define NGC_CHECK(condition) ngc_test :: check((condition), #condition, __FILE__, __LINE__)
+
+namespace ngc_test
+{
+  inline int failures = 0;
+
+  inline void check(bool success, const char * condition, const char * file, int line)
+  {
+    if(!success)
+    {
+      fprintf(stderr, "%s:%d: check failed: %s\n", file, line, condition);
+      failures++;
+    }
+  }
+
+  inline int result()
+  {
+    return failures ? 1 : 0;
+  }
+};
+
+#endif
@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+#
+# Compares the code generated for the pairs of functions in pairs.cpp.
+#
+#   check.py OBJDUMP OBJECT EXPECTED
+#
+# Disassembles OBJECT with OBJDUMP, normalizes the instructions of every
+# function (addresses, raw bytes, padding and the names of the functions
+# themselves are dropped), then checks every pair listed in EXPECTED:
+#
+#   identical  ngc_name must compile to the same instructions as native_name.
+#   no-longer  ngc_name must compile to no more instructions than native_name.
+#
+# Every pair in OBJECT must be listed in EXPECTED, and vice versa. On
+# failure, the two instruction streams of each failing pair are printed as
+# a diff, and the exit status is 1.
+
+import difflib
+import re
+import subprocess
+import sys
+
+FUNCTION = re.compile(r'^[0-9a-f]+ <(?P<name>[^>]+)>:$')
+INSTRUCTION = re.compile(r'^\s*[0-9a-f]+:\s+(?P<text>.+)$')
+RELOCATION = re.compile(r'^\s*[0-9a-f]+:\s+R_\S+\s+(?P<symbol>\S+)$')
+PADDING = re.compile(r'^(nop|xchg\s+%ax,%ax|data16|cs nop|int3)')
+
+
+def disassemble(objdump, path):
+    output = subprocess.run([objdump, '-dr', '--no-show-raw-insn', path], check=True, capture_output=True, text=True).stdout
+    functions = {}
+    name = None
+
+    for line in output.splitlines():
+        match = FUNCTION.match(line)
+
+        if match:
+            name = match.group('name')
+            functions[name] = []
+            continue
+
+        if name is None:
+            continue
+
+        match = RELOCATION.match(line)
+
+        if match:
+            functions[name][-1] += ' [' + match.group('symbol') + ']'
+            continue
+
+        match = INSTRUCTION.match(line)
+
+        if match:
+            functions[name].append(normalize(match.group('text'), name))
+
+    for name, instructions in functions.items():
+        while instructions and PADDING.match(instructions[-1]):
+            instructions.pop()
+
+    return functions
+
+
+def normalize(text, name):
+    text = re.sub(r'\s+', ' ', text.strip())
+    text = re.sub(r'<' + re.escape(name) + r'(\+0x[0-9a-f]+)?>', r'<\1>', text)
+    return re.sub(r'^(j\w+|call|jmp) [0-9a-f]+ ', r'\1 ', text)
+
+
+def pairs(functions):
+    return {name[len('ngc_'):] for name in functions if name.startswith('ngc_')}
+
+
+def main(objdump, path, expected):
+    functions = disassemble(objdump, path)
+    expectations = {}
+
+    with open(expected) as file:
+        for line in file:
+            line = line.split('#')[0].split()
+
+            if line:
+                expectations[line[0]] = line[1]
+
+    failures = 0
+
+    for pair in sorted(pairs(functions) | set(expectations)):
+        ngc = functions.get('ngc_' + pair)
+        native = functions.get('native_' + pair)
+        expectation = expectations.get(pair)
+
+        if ngc is None or native is None or expectation is None:
+            print('%s: missing function or expectation' % pair)
+            failures += 1
+            continue
+
+        if expectation == 'identical':
+            success = ngc == native
+        elif expectation == 'no-longer':
+            success = len(ngc) <= len(native)
+        else:
+            print('%s: unknown expectation %s' % (pair, expectation))
+            failures += 1
+            continue
+
+        print('%s: %s (%d instructions, %d by hand) %s' % (pair, expectation, len(ngc), len(native), 'ok' if success else 'FAILED'))
+
+        if not success:
+            sys.stdout.writelines(difflib.unified_diff([i + '\n' for i in native], [i + '\n' for i in ngc], 'native_' + pair, 'ngc_' + pair))
+            failures += 1
+
+    return 1 if failures else 0
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 4:
+        print('Usage: check.py OBJDUMP OBJECT EXPECTED', file=sys.stderr)
+        sys.exit(2)
+
+    sys.exit(main(*sys.argv[1:]))
@@ -0,0 +1,133 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file pairs.cpp
+
+  This file includes pairs of functions that do the same through the core
+  library (\c ngc_name) and by hand (\c native_name). check.py disassembles
+  them and compares their instructions, as required by expected.txt: the core
+  library claims that these operations come at no cost, i.e., that they
+  compile to the same code as their hand-written equivalent.
+
+  \see test/codegen/check.py
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#include <new>
+
+#include "../parsed.h"
+
+extern "C"
+{
+  // Embodiment
+
+  double ngc_embody(__ngc_phantom_base__ <point> & that)
+  {
+    return that.__ngc_embody__().y;
+  }
+
+  double native_embody(point & that)
+  {
+    return that.y;
+  }
+
+  double ngc_embody_const(const __ngc_phantom_base__ <point> & that)
+  {
+    return __ngc_embody__(that).y;
+  }
+
+  double native_embody_const(const point & that)
+  {
+    return that.y;
+  }
+
+  // Optionals
+
+  double ngc_unwrap(const __ngc_optional__ <point> & that)
+  {
+    return that.__ngc_exists__ ? __ngc_unwrap__(that).x : 0.;
+  }
+
+  double native_unwrap(const native_optional_point & that)
+  {
+    return that.exists ? that.value.x : 0.;
+  }
+
+  // Introspection
+
+  double ngc_member_get(const point & that)
+  {
+    return point :: __ngc_member__ <1, false> :: get(that) + that[ngc :: string <'x'> {}];
+  }
+
+  double native_member_get(const point & that)
+  {
+    return that.y + that.x;
+  }
+
+  // Factory
+
+  void ngc_initialize(point & that, double x, double y, double z, int tag)
+  {
+    __ngc_initialize__(that, ngc :: string <'t', 'a', 'g'> {}, tag, ngc :: string <'z'> {}, z, ngc :: string <'x'> {}, x, ngc :: string <'y'> {}, y);
+  }
+
+  void native_initialize(native_point & that, double x, double y, double z, int tag)
+  {
+    new (&that) native_point(x, y, z, tag);
+  }
+
+  void ngc_construct_array(int (& that)[4], int a, int b, int c, int d)
+  {
+    __ngc_construct__(that, a, b, c, d);
+  }
+
+  void native_construct_array(int (& that)[4], int a, int b, int c, int d)
+  {
+    that[0] = a;
+    that[1] = b;
+    that[2] = c;
+    that[3] = d;
+  }
+
+  void ngc_copy(point & that, const point & other)
+  {
+    __ngc_construct__(that, other);
+  }
+
+  void native_copy(native_point & that, const native_point & other)
+  {
+    new (&that) native_point(other);
+  }
+
+  void ngc_destruct_trivial(point & that)
+  {
+    __ngc_destruct__(that);
+  }
+
+  void native_destruct_trivial(native_point & that)
+  {
+    that.~native_point();
+  }
+
+  void ngc_destruct(sample & that)
+  {
+    __ngc_destruct__(that);
+  }
+
+  void native_destruct(native_sample & that)
+  {
+    that.~native_sample();
+  }
+};
@@ -0,0 +1,111 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file wide.cpp
+
+  This file tests the factory on a class with more members than the default
+  template instantiation depth of GCC (900): initializing, copying and
+  destructing it must not recurse once per member.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#include <string>
+
+#include "ngc.h"
+
+#include "../check.h"
+
+// WIDE_MEMBERS(1) declares the members m1000 to m1999, with indexes from 0 to 999.
+
+#define WIDE_DIGIT(number, weight) (char) ('0' + (number) / (weight) % 10)
+
+#define WIDE_MEMBER(number) \
+  int m##number; \
+  \
+  template <bool dummy> struct __ngc_member__ <number - 1000, dummy> \
+  { \
+    typedef int type; \
+    typedef ngc :: string <'m', WIDE_DIGIT(number, 1000), WIDE_DIGIT(number, 100), WIDE_DIGIT(number, 10), WIDE_DIGIT(number, 1)> name; \
+    \
+    static inline type & get(wide & that) \
+    { \
+      return that.m##number; \
+    } \
+    \
+    static inline const type & get(const wide & that) \
+    { \
+      return that.m##number; \
+    } \
+  };
+
+#define WIDE_10(prefix) WIDE_MEMBER(prefix##0) WIDE_MEMBER(prefix##1) WIDE_MEMBER(prefix##2) WIDE_MEMBER(prefix##3) WIDE_MEMBER(prefix##4) WIDE_MEMBER(prefix##5) WIDE_MEMBER(prefix##6) WIDE_MEMBER(prefix##7) WIDE_MEMBER(prefix##8) WIDE_MEMBER(prefix##9)
+#define WIDE_100(prefix) WIDE_10(prefix##0) WIDE_10(prefix##1) WIDE_10(prefix##2) WIDE_10(prefix##3) WIDE_10(prefix##4) WIDE_10(prefix##5) WIDE_10(prefix##6) WIDE_10(prefix##7) WIDE_10(prefix##8) WIDE_10(prefix##9)
+#define WIDE_MEMBERS(prefix) WIDE_100(prefix##0) WIDE_100(prefix##1) WIDE_100(prefix##2) WIDE_100(prefix##3) WIDE_100(prefix##4) WIDE_100(prefix##5) WIDE_100(prefix##6) WIDE_100(prefix##7) WIDE_100(prefix##8) WIDE_100(prefix##9)
+
+class wide
+{
+public:
+
+  typedef wide __ngc_introspected__;
+  template <size_t, bool> struct __ngc_member__;
+
+  inline void __ngc_destruct__()
+  {
+  }
+
+  WIDE_MEMBERS(1)
+
+  std :: string tail;
+
+  template <bool dummy> struct __ngc_member__ <1000, dummy>
+  {
+    typedef std :: string type;
+    typedef ngc :: string <'t', 'a', 'i', 'l'> name;
+
+    static inline type & get(wide & that)
+    {
+      return that.tail;
+    }
+
+    static inline const type & get(const wide & that)
+    {
+      return that.tail;
+    }
+  };
+};
+
+int main()
+{
+  NGC_CHECK(__ngc_member_count__ <wide> :: value == 1001);
+
+  static __ngc_phantom_base__ <wide> original(__ngc_null__);
+  static __ngc_phantom_base__ <wide> copy(__ngc_null__);
+
+  __ngc_initialize__(original.__ngc_embody__(), ngc :: string <'m', '1', '0', '0', '7'> {}, 7, ngc :: string <'m', '1', '9', '9', '9'> {}, 1999, ngc :: string <'t', 'a', 'i', 'l'> {}, "a tail longer than the small buffer");
+
+  NGC_CHECK(original.__ngc_embody__().m1007 == 7);
+  NGC_CHECK(original.__ngc_embody__().m1999 == 1999);
+  NGC_CHECK(original.__ngc_embody__().tail == "a tail longer than the small buffer");
+
+  __ngc_construct__(copy.__ngc_embody__(), original.__ngc_embody__());
+
+  NGC_CHECK(copy.__ngc_embody__().m1007 == 7);
+  NGC_CHECK(copy.__ngc_embody__().m1999 == 1999);
+  NGC_CHECK(copy.__ngc_embody__().tail == original.__ngc_embody__().tail);
+
+  __ngc_destruct__(copy.__ngc_embody__());
+  __ngc_destruct__(original.__ngc_embody__());
+
+  return ngc_test :: result();
+}
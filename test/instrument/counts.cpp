@@ -0,0 +1,121 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file counts.cpp
+
+  This file tests the counts of the instrumentation mode: every object,
+  member and array element that is constructed and then destructed must be
+  counted once by each, so that constructions and destructions balance for
+  every type, and the engagements and disengagements recorded by an optional
+  must follow its state.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#include <string>
+#include <typeinfo>
+
+#include "../parsed.h"
+#include "../check.h"
+
+namespace
+{
+  template <typename type> uint64_t count(ngc :: instrument :: event what)
+  {
+    std :: string name = __ngc_instrument__ :: demangle(typeid(type).name());
+
+    for(const ngc :: instrument :: entry & entry : ngc :: instrument :: collect())
+      if(entry.name == name)
+        return entry.count[what];
+
+    return 0;
+  }
+};
+
+int main()
+{
+  // Default construction of an array of introspected classes. The storage is
+  // value-initialized: at -O2, g++ 12 takes the address recorded by
+  // __ngc_construct__ for a read of the doubles, and warns they may be used
+  // uninitialized.
+
+  storage <point [4]> points {};
+
+  __ngc_construct__(points.get());
+  __ngc_destruct__(points.get());
+
+  NGC_CHECK((count <point [4]> (ngc :: instrument :: construct) == 1));
+  NGC_CHECK((count <point [4]> (ngc :: instrument :: destruct) == 1));
+  NGC_CHECK(count <point> (ngc :: instrument :: construct) == 4);
+  NGC_CHECK(count <point> (ngc :: instrument :: destruct) == 4);
+  NGC_CHECK(count <double> (ngc :: instrument :: construct) == 12);
+  NGC_CHECK(count <double> (ngc :: instrument :: destruct) == 12);
+
+  // Partial initialization list, copy
+
+  storage <int [3]> listed;
+  storage <int [3]> copied;
+
+  __ngc_construct__(listed.get(), 1, 2);
+  __ngc_construct__(copied.get(), listed.get());
+
+  NGC_CHECK(copied.get()[0] == 1 && copied.get()[1] == 2);
+
+  __ngc_destruct__(copied.get());
+  __ngc_destruct__(listed.get());
+
+  NGC_CHECK((count <int [3]> (ngc :: instrument :: construct) == 2));
+  NGC_CHECK((count <int [3]> (ngc :: instrument :: destruct) == 2));
+
+  // Arrays of arrays of classes with non-trivial members
+
+  storage <sample [2][2]> samples;
+
+  __ngc_construct__(samples.get());
+  samples.get()[1][1].label = "a label longer than the small buffer";
+  __ngc_destruct__(samples.get());
+
+  NGC_CHECK((count <sample [2]> (ngc :: instrument :: construct) == 2));
+  NGC_CHECK((count <sample [2]> (ngc :: instrument :: destruct) == 2));
+  NGC_CHECK(count <sample> (ngc :: instrument :: construct) == 4);
+  NGC_CHECK(count <sample> (ngc :: instrument :: destruct) == 4);
+  NGC_CHECK(count <std :: string> (ngc :: instrument :: construct) == 4);
+  NGC_CHECK(count <std :: string> (ngc :: instrument :: destruct) == 4);
+
+  // Engagement and disengagement of optionals
+
+  {
+    __ngc_optional__ <point> engaged(__ngc_default__);
+    engaged(__ngc_default__);
+
+    __ngc_optional__ <point> moved(static_cast <__ngc_optional__ <point> &&> (engaged));
+    moved(point());
+
+    __ngc_optional__ <point> assigned;
+
+    assigned = static_cast <__ngc_optional__ <point> &&> (moved);
+    assigned.__ngc_delete__();
+
+    NGC_CHECK(engaged.__ngc_exists__ && moved.__ngc_exists__ && !(assigned.__ngc_exists__));
+  }
+
+  NGC_CHECK(count <point> (ngc :: instrument :: engage) == 5);
+  NGC_CHECK(count <point> (ngc :: instrument :: disengage) == 5);
+
+  // Every construction was matched by a destruction
+
+  for(const ngc :: instrument :: entry & entry : ngc :: instrument :: collect())
+    NGC_CHECK(entry.count[ngc :: instrument :: construct] == entry.count[ngc :: instrument :: destruct]);
+
+  return ngc_test :: result();
+}
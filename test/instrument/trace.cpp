@@ -0,0 +1,82 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file trace.cpp
+
+  This file tests the traces of the instrumentation mode: every slice that
+  begins with a construction must end with a destruction, and an array, its
+  elements and their members must appear as distinct slices even when they
+  share their address.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+
+#include "../parsed.h"
+#include "../check.h"
+
+namespace
+{
+  std :: string field(const std :: string & line, const std :: string & name)
+  {
+    std :: string key = "\"" + name + "\":\"";
+    size_t begin = line.find(key);
+
+    if(begin == std :: string :: npos)
+      return "";
+
+    begin += key.size();
+    return line.substr(begin, line.find('"', begin) - begin);
+  }
+};
+
+int main()
+{
+  storage <point [4]> points {};
+
+  ngc :: instrument :: trace(1);
+
+  __ngc_construct__(points.get());
+  __ngc_destruct__(points.get());
+
+  const char * path = "ngc.trace.test.json";
+  NGC_CHECK(ngc :: instrument :: dump(path));
+
+  std :: ifstream file(path);
+  std :: map <std :: string, int> depths;
+  std :: string line;
+
+  while(std :: getline(file, line))
+  {
+    std :: string id = field(line, "id");
+    std :: string phase = field(line, "ph");
+
+    if(phase == "b")
+      depths[id]++;
+    else if(phase == "e")
+      NGC_CHECK(--depths[id] >= 0);
+  }
+
+  NGC_CHECK(depths.size() == 1 + 4 + 4 * 4); // The array, its points, and the members of each point.
+
+  for(const auto & depth : depths)
+    NGC_CHECK(depth.second == 0);
+
+  std :: remove(path);
+
+  return ngc_test :: result();
+}
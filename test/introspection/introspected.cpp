@@ -0,0 +1,48 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file introspected.cpp
+
+  This file tests \c __ngc_is_introspected__: it must hold for the classes
+  lowered by the parser, whatever their cv-qualifiers, and neither for the
+  classes that only inherit the \c __ngc_introspected__ typedef, nor for
+  primitives and classes that were not processed by the parser.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#include <string>
+
+#include "../parsed.h"
+#include "../check.h"
+
+class derived : public point
+{
+};
+
+int main()
+{
+  NGC_CHECK(__ngc_is_introspected__ <point> :: value);
+  NGC_CHECK(__ngc_is_introspected__ <const point> :: value);
+  NGC_CHECK(__ngc_is_introspected__ <volatile point> :: value);
+  NGC_CHECK(__ngc_is_introspected__ <const volatile sample> :: value);
+
+  NGC_CHECK(!__ngc_is_introspected__ <derived> :: value);
+  NGC_CHECK(!__ngc_is_introspected__ <const derived> :: value);
+  NGC_CHECK(!__ngc_is_introspected__ <int> :: value);
+  NGC_CHECK(!__ngc_is_introspected__ <const int> :: value);
+  NGC_CHECK(!__ngc_is_introspected__ <std :: string> :: value);
+  NGC_CHECK(!__ngc_is_introspected__ <const std :: string> :: value);
+
+  return ngc_test :: result();
+}
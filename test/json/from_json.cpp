@@ -0,0 +1,124 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file from_json.cpp
+
+  This file tests \c ngc \c :: \c from_json: numbers must follow the grammar
+  of RFC 8259, skipped objects and arrays must be well formed and hold valid
+  values only, escapes in skipped strings must be valid, \c null must be
+  read as NaN into floating point members, what \c ngc \c :: \c to_json
+  writes must read back, and the members of a class must hide the members of
+  its base classes with the same name.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include "../parsed.h"
+#include "../check.h"
+#include "ngc/json.h"
+
+class tagged : public point
+{
+public:
+
+  typedef tagged __ngc_introspected__;
+  template <size_t, bool> struct __ngc_member__;
+  template <size_t, bool> struct __ngc_base__;
+
+  inline void __ngc_destruct__()
+  {
+  }
+
+  template <bool dummy> struct __ngc_base__ <0, dummy>
+  {
+    typedef point type;
+  };
+
+  long tag;
+  NGC_PARSED_MEMBER(tagged, 0, long, tag, 't', 'a', 'g')
+};
+
+int main()
+{
+  point that = {1, 2, 3, 0};
+
+  // Numbers
+
+  const char * const valid[] = {"{\"x\":0}", "{\"x\":-0}", "{\"x\":-0.5}", "{\"x\":10}", "{\"x\":1e3}", "{\"x\":1E+3}", "{\"x\":0.25e-2}", "{\"tag\":-7}", "{\"skipped\":0.5e1}"};
+
+  for(const char * json : valid)
+    NGC_CHECK(ngc :: from_json(json, that));
+
+  const char * const invalid[] = {"{\"x\":inf}", "{\"x\":-inf}", "{\"x\":nan}", "{\"x\":Infinity}", "{\"x\":03}", "{\"x\":-03}", "{\"x\":00}", "{\"x\":+1}", "{\"x\":.5}", "{\"x\":1.}", "{\"x\":1e}", "{\"x\":1e+}", "{\"x\":-}", "{\"tag\":03}", "{\"tag\":1.5}", "{\"tag\":1e2}", "{\"tag\":null}", "{\"skipped\":03}", "{\"skipped\":nan}"};
+
+  for(const char * json : invalid)
+    NGC_CHECK(!ngc :: from_json(json, that));
+
+  // Skipped values
+
+  const char * const skipped[] = {"{\"skipped\":[]}", "{\"skipped\":{}}", "{\"skipped\": [ [ ] , { } , [ { \"a\" : [ 1 , true , null , \"]}\" ] } ] ] ,\"x\":1}", "{\"skipped\":{\"a\":{\"b\":{\"c\":[-0.5e3,\"\\\"\"]}},\"d\":false}}"};
+
+  for(const char * json : skipped)
+    NGC_CHECK(ngc :: from_json(json, that));
+
+  const char * const malformed[] = {"{\"x\":5,\"zz\":[}}", "{\"skipped\":[nan, 03, garbage]}", "{\"skipped\":[03]}", "{\"skipped\":[1,]}", "{\"skipped\":[1 2]}", "{\"skipped\":[,1]}", "{\"skipped\":{\"a\"}}", "{\"skipped\":{\"a\":1,}}", "{\"skipped\":{1:2}}", "{\"skipped\":{\"a\":1]}", "{\"skipped\":[[[]]}", "{\"skipped\":[tru]}", "{\"skipped\":[\"a]}"};
+
+  for(const char * json : malformed)
+    NGC_CHECK(!ngc :: from_json(json, that));
+
+  // Escapes in skipped strings are checked as in decoded ones.
+
+  const char * const escaped[] = {"{\"skipped\":\"\\\"\\\\\\/\\b\\f\\n\\r\\t\"}", "{\"skipped\":\"\\u00e9\\uD83D\\uDE00\"}", "{\"skipped\":[{\"\\u0041\":\"\\ud83d\\ude00\"}]}"};
+
+  for(const char * json : escaped)
+    NGC_CHECK(ngc :: from_json(json, that));
+
+  const char * const misescaped[] = {"{\"unknown\":\"\\q\"}", "{\"unknown\":\"\\u12g4\"}", "{\"unknown\":\"\\u12\"}", "{\"unknown\":\"\\ud83d\"}", "{\"unknown\":\"\\ud83dx\"}", "{\"unknown\":\"\\ud83d\\u0041\"}", "{\"unknown\":\"\\ude00\"}", "{\"unknown\":\"\\", "{\"unknown\":[\"\\x\"]}", "{\"unknown\":{\"\\q\":1}}"};
+
+  for(const char * json : misescaped)
+    NGC_CHECK(!ngc :: from_json(json, that));
+
+  // Non-finite values
+
+  NGC_CHECK(ngc :: from_json("{\"x\":null,\"y\":4.5}", that));
+  NGC_CHECK(std :: isnan(that.x));
+  NGC_CHECK(that.y == 4.5);
+
+  that.x = std :: numeric_limits <double> :: infinity();
+  that.y = 0.1;
+  that.tag = -12;
+
+  point copy = ngc :: from_json <point> (ngc :: to_json(that));
+
+  NGC_CHECK(std :: isnan(copy.x));
+  NGC_CHECK(copy.y == 0.1);
+  NGC_CHECK(copy.tag == -12);
+
+  // Members hide the members of the base classes
+
+  tagged object;
+  object.x = 0;
+  object.tag = 0;
+  ((point &) object).tag = 0;
+
+  NGC_CHECK(ngc :: from_json("{\"tag\":5,\"x\":2.5}", object));
+  NGC_CHECK(object.tag == 5);
+  NGC_CHECK(((point &) object).tag == 0);
+  NGC_CHECK(object.x == 2.5);
+
+  return ngc_test :: result();
+}
@@ -0,0 +1,158 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file to_json.cpp
+
+  This file tests \c ngc \c :: \c to_json: strings must be escaped, the key
+  fragment of the first field must open the object and the others must
+  follow a comma, the members of the base classes must be written first, in
+  the same object, nested objects must be written as objects, and empty
+  optionals, non-finite floating point values and null \c const \c char
+  \c * must be written as \c null. A \c char array must be read up to its
+  extent if it has no null character.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 18, 2026
+*/
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../parsed.h"
+#include "../check.h"
+#include "ngc/json.h"
+
+class labelled : public point
+{
+public:
+
+  typedef labelled __ngc_introspected__;
+  template <size_t, bool> struct __ngc_member__;
+  template <size_t, bool> struct __ngc_base__;
+
+  inline void __ngc_destruct__()
+  {
+  }
+
+  template <bool dummy> struct __ngc_base__ <0, dummy>
+  {
+    typedef point type;
+  };
+
+  char code[4];
+  NGC_PARSED_MEMBER(labelled, 0, decltype(code), code, 'c', 'o', 'd', 'e')
+
+  const char * note;
+  NGC_PARSED_MEMBER(labelled, 1, const char *, note, 'n', 'o', 't', 'e')
+};
+
+class route
+{
+public:
+
+  typedef route __ngc_introspected__;
+  template <size_t, bool> struct __ngc_member__;
+
+  inline void __ngc_destruct__()
+  {
+  }
+
+  point from;
+  NGC_PARSED_MEMBER(route, 0, point, from, 'f', 'r', 'o', 'm')
+
+  __ngc_optional__ <point> to;
+  NGC_PARSED_MEMBER(route, 1, __ngc_optional__ <point>, to, 't', 'o')
+
+  std :: vector <int> stops;
+  NGC_PARSED_MEMBER(route, 2, std :: vector <int>, stops, 's', 't', 'o', 'p', 's')
+};
+
+template <bool first, typename name> std :: string_view fragment()
+{
+  return std :: string_view(__ngc_json_writer__ :: key <first, name> :: value, __ngc_json_writer__ :: key <first, name> :: size);
+}
+
+int main()
+{
+  // Escaping
+
+  NGC_CHECK(ngc :: to_json(std :: string("plain")) == "\"plain\"");
+  NGC_CHECK(ngc :: to_json(std :: string("a\"b\\c")) == "\"a\\\"b\\\\c\"");
+  NGC_CHECK(ngc :: to_json(std :: string("\b\f\n\r\t")) == "\"\\b\\f\\n\\r\\t\"");
+  NGC_CHECK(ngc :: to_json(std :: string("\x01 \x1f", 3)) == "\"\\u0001 \\u001f\"");
+  NGC_CHECK(ngc :: to_json(std :: string("\0", 1)) == "\"\\u0000\"");
+  NGC_CHECK(ngc :: to_json(std :: string("caf\xc3\xa9\x7f")) == "\"caf\xc3\xa9\x7f\"");
+
+  // Key fragments
+
+  NGC_CHECK((fragment <true, ngc :: string <'x'>> ()) == "{\"x\":");
+  NGC_CHECK((fragment <false, ngc :: string <'t', 'a', 'g'>> ()) == ",\"tag\":");
+
+  point p = {1, 2.5, -3, 4};
+  NGC_CHECK(ngc :: to_json(p) == "{\"x\":1,\"y\":2.5,\"z\":-3,\"tag\":4}");
+
+  std :: string buffer = "[";
+  ngc :: to_json(p, buffer);
+  NGC_CHECK(buffer == "[{\"x\":1,\"y\":2.5,\"z\":-3,\"tag\":4}");
+
+  // Base classes, char arrays and char pointers
+
+  labelled l;
+  l.x = 0.5;
+  l.y = 0;
+  l.z = 1e300;
+  l.tag = -1;
+  l.code[0] = 'a';
+  l.code[1] = 'b';
+  l.code[2] = '\0';
+  l.code[3] = 'z';
+  l.note = "n\"1";
+
+  NGC_CHECK(ngc :: to_json(l) == "{\"x\":0.5,\"y\":0,\"z\":1e+300,\"tag\":-1,\"code\":\"ab\",\"note\":\"n\\\"1\"}");
+
+  l.code[2] = 'c';
+  l.code[3] = 'd';
+  l.note = nullptr;
+
+  NGC_CHECK(ngc :: to_json(l) == "{\"x\":0.5,\"y\":0,\"z\":1e+300,\"tag\":-1,\"code\":\"abcd\",\"note\":null}");
+
+  // Non-finite values
+
+  NGC_CHECK(ngc :: to_json(std :: numeric_limits <double> :: infinity()) == "null");
+  NGC_CHECK(ngc :: to_json(-std :: numeric_limits <double> :: infinity()) == "null");
+  NGC_CHECK(ngc :: to_json(std :: numeric_limits <float> :: quiet_NaN()) == "null");
+
+  p.y = std :: nan("");
+  NGC_CHECK(ngc :: to_json(p) == "{\"x\":1,\"y\":null,\"z\":-3,\"tag\":4}");
+
+  // Nested objects and optionals
+
+  route r;
+  r.from = {1, 2, 3, 4};
+  r.stops = {};
+
+  NGC_CHECK(ngc :: to_json(r) == "{\"from\":{\"x\":1,\"y\":2,\"z\":3,\"tag\":4},\"to\":null,\"stops\":[]}");
+
+  r.to(point {5, 6, 7, 8});
+  r.stops = {1, -2, 3};
+
+  NGC_CHECK(ngc :: to_json(r) == "{\"from\":{\"x\":1,\"y\":2,\"z\":3,\"tag\":4},\"to\":{\"x\":5,\"y\":6,\"z\":7,\"tag\":8},\"stops\":[1,-2,3]}");
+
+  r.to.__ngc_delete__();
+
+  NGC_CHECK(ngc :: to_json(r) == "{\"from\":{\"x\":1,\"y\":2,\"z\":3,\"tag\":4},\"to\":null,\"stops\":[1,-2,3]}");
+
+  return ngc_test :: result();
+}
@@ -0,0 +1,240 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file ring.cpp
+
+  This file tests \c ngc \c :: \c log and \c ngc \c :: \c logger: records
+  must survive wrapping around the end of a ring, objects that do not fit in
+  a full ring must be dropped and counted, the records of several producers
+  must all be drained, each in the order its thread logged them, and the
+  ring of a thread must be retired, with its records and its drops, when the
+  thread exits.
+
+  The test is built with a ring of 4096 bytes, i.e., 73 records of a
+  \c trade object (a 16 byte header, followed by 40 bytes).
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 18, 2026
+*/
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "../parsed.h"
+#include "../check.h"
+#include "ngc/json.h"
+#include "ngc/log.h"
+
+static_assert(NGC_LOG_CAPACITY == 4096, "The test expects rings of 4096 bytes.");
+
+namespace
+{
+  constexpr size_t record = sizeof(__ngc_log__ :: header) + __ngc_log__ :: align(sizeof(trade));
+  constexpr size_t fit = __ngc_log__ :: capacity / record;
+
+  trade make(uint64_t id, uint32_t venue)
+  {
+    trade that;
+
+    that.id = id;
+    that.price = 0.5 * id;
+    that.qty = (uint32_t) (id % 100);
+    that.venue = venue;
+    that.time = id * 1000;
+    that.account = 7;
+
+    return that;
+  }
+
+  std :: string line(const trade & that)
+  {
+    return ngc :: to_json(that) + '\n';
+  }
+
+  // Splits drained lines, and reads each back into a trade.
+
+  std :: vector <trade> parse(const std :: string & lines)
+  {
+    std :: vector <trade> trades;
+    size_t begin = 0;
+
+    while(begin < lines.size())
+    {
+      size_t end = lines.find('\n', begin);
+      trade that;
+
+      NGC_CHECK(end != std :: string :: npos);
+      NGC_CHECK(ngc :: from_json(std :: string_view(lines).substr(begin, end - begin), that));
+
+      trades.push_back(that);
+      begin = end + 1;
+    }
+
+    return trades;
+  }
+
+  size_t rings()
+  {
+    __ngc_log__ :: registry & global = __ngc_log__ :: global();
+    std :: lock_guard <std :: mutex> lock(global.mutex);
+
+    return global.rings.size();
+  }
+};
+
+int main()
+{
+  static_assert(fit == 73, "");
+
+  // Wraparound: records that straddle the end of the ring, header or object,
+  // must be read back as they were written.
+
+  {
+    std :: string expected;
+    std :: string drained;
+    bool counts = true;
+
+    for(uint64_t round = 0; round < 100; round++)
+    {
+      std :: string batch;
+
+      for(uint64_t i = 0; i < 10; i++)
+      {
+        trade that = make(round * 10 + i, 0);
+
+        NGC_CHECK(ngc :: log(that));
+        batch += line(that);
+      }
+
+      expected += batch;
+      counts = counts && ngc :: logger :: drain(drained) == 10;
+    }
+
+    NGC_CHECK(100 * 10 * record > 10 * __ngc_log__ :: capacity);
+    NGC_CHECK(counts);
+    NGC_CHECK(drained == expected);
+  }
+
+  // Drops: a full ring rejects objects until it is drained, and counts them.
+
+  {
+    uint64_t before = ngc :: logger :: dropped();
+
+    std :: string expected;
+    size_t logged = 0;
+
+    while(ngc :: log(make(logged, 1)))
+      expected += line(make(logged++, 1));
+
+    for(uint64_t i = 0; i < 5; i++)
+      NGC_CHECK(!(ngc :: log(make(i, 1))));
+
+    NGC_CHECK(logged == fit);
+    NGC_CHECK(ngc :: logger :: dropped() == before + 6);
+
+    std :: string drained;
+
+    NGC_CHECK(ngc :: logger :: drain(drained) == fit);
+    NGC_CHECK(drained == expected);
+
+    NGC_CHECK(ngc :: log(make(0, 1)));
+    NGC_CHECK(ngc :: logger :: dropped() == before + 6);
+
+    drained.clear();
+    NGC_CHECK(ngc :: logger :: drain(drained) == 1);
+  }
+
+  // Several producers: the main thread drains while four threads log, and
+  // retry when their ring is full.
+
+  {
+    constexpr uint32_t producers = 4;
+    constexpr uint64_t count = 5000;
+
+    std :: atomic <uint32_t> running {producers};
+    std :: vector <std :: thread> threads;
+
+    for(uint32_t venue = 0; venue < producers; venue++)
+      threads.emplace_back([venue, &running]()
+      {
+        for(uint64_t id = 0; id < count; id++)
+          while(!(ngc :: log(make(id, venue))))
+            std :: this_thread :: yield();
+
+        running--;
+      });
+
+    std :: string drained;
+    size_t records = 0;
+
+    while(running.load())
+      records += ngc :: logger :: drain(drained);
+
+    for(std :: thread & thread : threads)
+      thread.join();
+
+    records += ngc :: logger :: drain(drained);
+
+    std :: vector <trade> trades = parse(drained);
+    std :: vector <uint64_t> next(producers, 0);
+    bool ordered = true;
+
+    for(const trade & that : trades)
+      if(that.venue < producers && that.id == next[that.venue] && that.time == that.id * 1000)
+        next[that.venue]++;
+      else
+        ordered = false;
+
+    NGC_CHECK(records == producers * count);
+    NGC_CHECK(trades.size() == producers * count);
+    NGC_CHECK(ordered);
+
+    for(uint32_t venue = 0; venue < producers; venue++)
+      NGC_CHECK(next[venue] == count);
+  }
+
+  // Retirement: the ring of a thread that exits is unregistered, and its
+  // records and drops are kept for the next drain.
+
+  {
+    size_t before = rings();
+    uint64_t dropped = ngc :: logger :: dropped();
+
+    std :: string expected;
+
+    std :: thread([&expected]()
+    {
+      size_t logged = 0;
+
+      while(ngc :: log(make(logged, 9)))
+        expected += line(make(logged++, 9));
+    }).join();
+
+    NGC_CHECK(rings() == before);
+    NGC_CHECK(ngc :: logger :: dropped() == dropped + 1);
+
+    std :: string drained;
+
+    NGC_CHECK(ngc :: logger :: drain(drained) == fit);
+    NGC_CHECK(drained == expected);
+
+    drained.clear();
+    NGC_CHECK(ngc :: logger :: drain(drained) == 0);
+    NGC_CHECK(drained.empty());
+  }
+
+  return ngc_test :: result();
+}
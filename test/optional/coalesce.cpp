@@ -0,0 +1,121 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file coalesce.cpp
+
+  This file tests \c __ngc_coalesce__, the lowering of \c x \c ?? \c y: an
+  engaged optional must yield its value without evaluating the fallback, an
+  empty one must evaluate the fallback once and yield its value. The value
+  must be copied out of an lvalue optional and moved out of an rvalue one.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 18, 2026
+*/
+
+#include <string>
+
+#include "../parsed.h"
+#include "../check.h"
+
+// A minimal optional of sample, whose label shows whether it was moved out.
+
+template <> class __ngc_optional__ <sample> : public __ngc_phantom_base__ <sample>
+{
+public:
+
+  bool __ngc_exists__;
+
+  inline __ngc_optional__() : __ngc_phantom_base__ <sample> (__ngc_null__), __ngc_exists__(false)
+  {
+  }
+
+  inline __ngc_optional__(sample && that) : __ngc_phantom_base__ <sample> (__ngc_null__), __ngc_exists__(true)
+  {
+    __ngc_construct__(this->__ngc_embody__(), static_cast <sample &&> (that));
+  }
+
+  inline ~__ngc_optional__()
+  {
+    if(this->__ngc_exists__)
+      __ngc_destruct__(this->__ngc_embody__());
+  }
+};
+
+int main()
+{
+  size_t evaluated = 0;
+
+  auto fallback = [&]()
+  {
+    evaluated++;
+    return point {-1, -2, -3, -4};
+  };
+
+  // Engaged: the fallback is not evaluated.
+
+  {
+    __ngc_optional__ <point> engaged(point {1, 2, 3, 4});
+    point value = __ngc_coalesce__(engaged, fallback);
+
+    NGC_CHECK(value.x == 1 && value.y == 2 && value.z == 3 && value.tag == 4);
+    NGC_CHECK(evaluated == 0);
+
+    value = __ngc_coalesce__(__ngc_optional__ <point> (point {5, 6, 7, 8}), fallback);
+
+    NGC_CHECK(value.x == 5 && value.tag == 8);
+    NGC_CHECK(evaluated == 0);
+  }
+
+  // Empty: the fallback is evaluated once.
+
+  {
+    __ngc_optional__ <point> empty;
+    point value = __ngc_coalesce__(empty, fallback);
+
+    NGC_CHECK(value.x == -1 && value.y == -2 && value.z == -3 && value.tag == -4);
+    NGC_CHECK(evaluated == 1);
+
+    value = __ngc_coalesce__(__ngc_optional__ <point> (), fallback);
+
+    NGC_CHECK(value.x == -1 && value.tag == -4);
+    NGC_CHECK(evaluated == 2);
+  }
+
+  // Copied out of an lvalue, moved out of an rvalue.
+
+  {
+    sample source;
+    source.label = "a label long enough not to fit in the small string buffer";
+
+    __ngc_optional__ <sample> engaged(static_cast <sample &&> (sample(source)));
+
+    auto empty = [&]()
+    {
+      evaluated++;
+      return sample();
+    };
+
+    sample copied = __ngc_coalesce__(engaged, empty);
+
+    NGC_CHECK(copied.label == source.label);
+    NGC_CHECK(engaged.__ngc_embody__().label == source.label);
+
+    sample moved = __ngc_coalesce__(static_cast <__ngc_optional__ <sample> &&> (engaged), empty);
+
+    NGC_CHECK(moved.label == source.label);
+    NGC_CHECK(engaged.__ngc_embody__().label.empty());
+    NGC_CHECK(engaged.__ngc_exists__);
+    NGC_CHECK(evaluated == 2);
+  }
+
+  return ngc_test :: result();
+}
@@ -0,0 +1,327 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file parsed.h
+
+  This file includes the classes the tests and the benchmarks run on, as the
+  parser lowers them (see reference/introspection/reference.md and
+  reference/optional/reference.md), together with their native equivalents,
+  i.e., the same classes written in plain C++. Both test/ and benchmark/
+  include this file, so that they run on the same lowered form, and share the
+  \c storage helper, that holds objects constructed through the factory.
+
+  \c NGC_PARSED_MEMBER expands to the \c __ngc_member__ specialization and to
+  the \c operator \c [] overloads that the parser emits for each member.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#ifndef __test__parsed__h
+#define __test__parsed__h
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "ngc.h"
+
+#define NGC_PARSED_MEMBER(class, index, mtype, member, ...) \
+  template <bool dummy> struct __ngc_member__ <index, dummy> \
+  { \
+    typedef mtype type; \
+    typedef ngc :: string <__VA_ARGS__> name; \
+    \
+    static inline type & get(class & that) \
+    { \
+      return that.member; \
+    } \
+    \
+    static inline const type & get(const class & that) \
+    { \
+      return that.member; \
+    } \
+  }; \
+  \
+  inline decltype(member) & operator [] (ngc :: string <__VA_ARGS__>) \
+  { \
+    return __ngc_member__ <index, false> :: get(*this); \
+  } \
+  \
+  inline const decltype(member) & operator [] (ngc :: string <__VA_ARGS__>) const \
+  { \
+    return __ngc_member__ <index, false> :: get(*this); \
+  }
+
+// Lowered classes
+
+class point
+{
+public:
+
+  typedef point __ngc_introspected__;
+  template <size_t, bool> struct __ngc_member__;
+
+  inline void __ngc_destruct__()
+  {
+  }
+
+  double x;
+  NGC_PARSED_MEMBER(point, 0, double, x, 'x')
+
+  double y;
+  NGC_PARSED_MEMBER(point, 1, double, y, 'y')
+
+  double z;
+  NGC_PARSED_MEMBER(point, 2, double, z, 'z')
+
+  int tag;
+  NGC_PARSED_MEMBER(point, 3, int, tag, 't', 'a', 'g')
+};
+
+class sample
+{
+public:
+
+  typedef sample __ngc_introspected__;
+  template <size_t, bool> struct __ngc_member__;
+
+  inline void __ngc_destruct__()
+  {
+  }
+
+  long timestamp;
+  NGC_PARSED_MEMBER(sample, 0, long, timestamp, 't', 'i', 'm', 'e', 's', 't', 'a', 'm', 'p')
+
+  int sensor;
+  NGC_PARSED_MEMBER(sample, 1, int, sensor, 's', 'e', 'n', 's', 'o', 'r')
+
+  double value;
+  NGC_PARSED_MEMBER(sample, 2, double, value, 'v', 'a', 'l', 'u', 'e')
+
+  std :: string label;
+  NGC_PARSED_MEMBER(sample, 3, std :: string, label, 'l', 'a', 'b', 'e', 'l')
+};
+
+class trade
+{
+public:
+
+  typedef trade __ngc_introspected__;
+  template <size_t, bool> struct __ngc_member__;
+
+  inline void __ngc_destruct__()
+  {
+  }
+
+  uint64_t id;
+  NGC_PARSED_MEMBER(trade, 0, uint64_t, id, 'i', 'd')
+
+  double price;
+  NGC_PARSED_MEMBER(trade, 1, double, price, 'p', 'r', 'i', 'c', 'e')
+
+  uint32_t qty;
+  NGC_PARSED_MEMBER(trade, 2, uint32_t, qty, 'q', 't', 'y')
+
+  uint32_t venue;
+  NGC_PARSED_MEMBER(trade, 3, uint32_t, venue, 'v', 'e', 'n', 'u', 'e')
+
+  uint64_t time;
+  NGC_PARSED_MEMBER(trade, 4, uint64_t, time, 't', 'i', 'm', 'e')
+
+  uint64_t account;
+  NGC_PARSED_MEMBER(trade, 5, uint64_t, account, 'a', 'c', 'c', 'o', 'u', 'n', 't')
+};
+
+template <> class __ngc_optional__ <point> : public __ngc_phantom_base__ <point>
+{
+public:
+
+  bool __ngc_exists__;
+
+  inline __ngc_optional__() : __ngc_phantom_base__ <point> (__ngc_null__), __ngc_exists__(false)
+  {
+  }
+
+  inline __ngc_optional__(__ngc_default_type__) : __ngc_phantom_base__ <point> (__ngc_null__)
+  {
+    this->__ngc_record__(true);
+    __ngc_construct__(this->__ngc_embody__());
+    this->__ngc_exists__ = true;
+  }
+
+  inline __ngc_optional__(point && that) : __ngc_phantom_base__ <point> (__ngc_null__)
+  {
+    this->__ngc_record__(true);
+    __ngc_construct__(this->__ngc_embody__(), static_cast <point &&> (that));
+    this->__ngc_exists__ = true;
+  }
+
+  inline __ngc_optional__(const __ngc_optional__ & that) : __ngc_phantom_base__ <point> (__ngc_null__), __ngc_exists__(that.__ngc_exists__)
+  {
+    if(this->__ngc_exists__)
+    {
+      this->__ngc_record__(true);
+      __ngc_construct__(this->__ngc_embody__(), that.__ngc_embody__());
+    }
+  }
+
+  inline __ngc_optional__(__ngc_optional__ && that) : __ngc_phantom_base__ <point> (__ngc_null__), __ngc_exists__(that.__ngc_exists__)
+  {
+    if(this->__ngc_exists__)
+    {
+      this->__ngc_record__(true);
+      __ngc_construct__(this->__ngc_embody__(), static_cast <point &&> (that.__ngc_embody__()));
+    }
+  }
+
+  inline ~__ngc_optional__()
+  {
+    this->__ngc_delete__();
+  }
+
+  inline void operator () (__ngc_default_type__)
+  {
+    if(this->__ngc_exists__)
+    {
+      this->__ngc_record__(false);
+      __ngc_destruct__(this->__ngc_embody__());
+    }
+
+    this->__ngc_record__(true);
+    this->__ngc_exists__ = true;
+    __ngc_construct__(this->__ngc_embody__());
+  }
+
+  inline void operator () (point && that)
+  {
+    if(this->__ngc_exists__)
+    {
+      this->__ngc_record__(false);
+      __ngc_destruct__(this->__ngc_embody__());
+    }
+
+    this->__ngc_record__(true);
+    this->__ngc_exists__ = true;
+    __ngc_construct__(this->__ngc_embody__(), static_cast <point &&> (that));
+  }
+
+  inline __ngc_optional__ & operator = (const __ngc_optional__ & that)
+  {
+    if(this->__ngc_exists__)
+    {
+      this->__ngc_record__(false);
+      __ngc_destruct__(this->__ngc_embody__());
+    }
+
+    this->__ngc_exists__ = that.__ngc_exists__;
+
+    if(this->__ngc_exists__)
+    {
+      this->__ngc_record__(true);
+      __ngc_construct__(this->__ngc_embody__(), that.__ngc_embody__());
+    }
+
+    return *this;
+  }
+
+  inline __ngc_optional__ & operator = (__ngc_optional__ && that)
+  {
+    if(this->__ngc_exists__)
+    {
+      this->__ngc_record__(false);
+      __ngc_destruct__(this->__ngc_embody__());
+    }
+
+    this->__ngc_exists__ = that.__ngc_exists__;
+
+    if(this->__ngc_exists__)
+    {
+      this->__ngc_record__(true);
+      __ngc_construct__(this->__ngc_embody__(), static_cast <point &&> (that.__ngc_embody__()));
+    }
+
+    return *this;
+  }
+
+  inline void __ngc_delete__()
+  {
+    if(this->__ngc_exists__)
+    {
+      this->__ngc_record__(false);
+      __ngc_destruct__(this->__ngc_embody__());
+      this->__ngc_exists__ = false;
+    }
+  }
+
+private:
+
+  // Records an engagement (or a disengagement) of this optional, and compiles
+  // to nothing when NGC_INSTRUMENT is not defined.
+
+  inline void __ngc_record__(bool engage)
+  {
+#ifdef NGC_INSTRUMENT
+    __ngc_instrument__ :: record <point> (engage ? __ngc_instrument__ :: engage : __ngc_instrument__ :: disengage, this);
+#else
+    (void) engage;
+#endif
+  }
+};
+
+// Helpers
+
+/**
+  \struct storage
+  \brief Uninitialized, aligned storage for an object of type \c type, to be
+  constructed and destructed explicitly through the factory (i.e.,
+  \c __ngc_construct__ and \c __ngc_destruct__ on \c get()).
+*/
+template <typename type> struct storage
+{
+  alignas(type) unsigned char bytes[sizeof(type)];
+
+  inline type & get()
+  {
+    return *reinterpret_cast <type *> (this->bytes);
+  }
+};
+
+// Native equivalents
+
+struct native_point
+{
+  double x;
+  double y;
+  double z;
+  int tag;
+
+  inline native_point(double x, double y, double z, int tag) : x(x), y(y), z(z), tag(tag)
+  {
+  }
+};
+
+struct native_sample
+{
+  long timestamp;
+  int sensor;
+  double value;
+  std :: string label;
+};
+
+struct native_optional_point
+{
+  native_point value;
+  bool exists;
+};
+
+#endif
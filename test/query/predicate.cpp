@@ -0,0 +1,184 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file predicate.cpp
+
+  This file tests the comparison predicates of \c ngc \c :: \c soa: on
+  columns and constants of different types, the SSE2 kernels (on full blocks
+  of 64 rows) and the scalar loop (on the last, partial block) must select
+  the same rows, the ones the C++ operator selects. It also tests the
+  queries built on them: \c select must copy the selected rows of each
+  column in order, both from full and from partially selected blocks, and
+  chained predicates must not be evaluated on blocks that are already empty.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 17, 2026
+*/
+
+#include <cstdint>
+#include <vector>
+
+#include "../parsed.h"
+#include "../check.h"
+#include "ngc/query.h"
+
+class reading
+{
+public:
+
+  typedef reading __ngc_introspected__;
+  template <size_t, bool> struct __ngc_member__;
+
+  inline void __ngc_destruct__()
+  {
+  }
+
+  uint32_t count;
+  NGC_PARSED_MEMBER(reading, 0, uint32_t, count, 'c', 'o', 'u', 'n', 't')
+
+  int32_t delta;
+  NGC_PARSED_MEMBER(reading, 1, int32_t, delta, 'd', 'e', 'l', 't', 'a')
+
+  int8_t level;
+  NGC_PARSED_MEMBER(reading, 2, int8_t, level, 'l', 'e', 'v', 'e', 'l')
+
+  float value;
+  NGC_PARSED_MEMBER(reading, 3, float, value, 'v', 'a', 'l', 'u', 'e')
+};
+
+namespace
+{
+  constexpr size_t rows = 100; // A full block, then a partial block of 36 rows.
+
+  // Checks that the rows selected by where(name, test) are those for which get(row) satisfies test.
+  template <typename ntype, typename ptype, typename gtype> void check(const ngc :: soa <reading> & readings, const reading * source, ntype name, const ptype & test, gtype && get, size_t expected)
+  {
+    std :: vector <uint64_t> bitmap = readings.where(name, test).bitmap();
+    size_t count = 0;
+
+    for(size_t i = 0; i < rows; i++)
+    {
+      bool selected = (bitmap[i / 64] >> (i % 64)) & 1;
+      NGC_CHECK(selected == test(get(source[i])));
+      count += selected;
+    }
+
+    NGC_CHECK(count == expected);
+  }
+};
+
+int main()
+{
+  static reading source[rows];
+  ngc :: soa <reading> readings;
+
+  for(size_t i = 0; i < rows; i++)
+  {
+    source[i].count = (i % 2) ? (uint32_t) i * 3 : 0xffffffff - (uint32_t) i;
+    source[i].delta = (int32_t) i - 50;
+    source[i].level = (int8_t) (i * 7);
+    source[i].value = (float) i / 4;
+
+    readings.push_back(source[i]);
+  }
+
+  auto count = [](const reading & that){ return that.count; };
+  auto delta = [](const reading & that){ return that.delta; };
+  auto level = [](const reading & that){ return that.level; };
+  auto value = [](const reading & that){ return that.value; };
+
+  // Signed constants on an unsigned column are converted as by the C++ operators.
+
+  check(readings, source, ngc :: string <'c', 'o', 'u', 'n', 't'> {}, ngc :: gt(100), count, 83);
+  check(readings, source, ngc :: string <'c', 'o', 'u', 'n', 't'> {}, ngc :: le(100), count, 17);
+  check(readings, source, ngc :: string <'c', 'o', 'u', 'n', 't'> {}, ngc :: gt(-1), count, 0);
+  check(readings, source, ngc :: string <'c', 'o', 'u', 'n', 't'> {}, ngc :: eq(-1), count, 1);
+  check(readings, source, ngc :: string <'c', 'o', 'u', 'n', 't'> {}, ngc :: ne(3u), count, 99);
+
+  // Unsigned and floating point constants on a signed column.
+
+  check(readings, source, ngc :: string <'d', 'e', 'l', 't', 'a'> {}, ngc :: lt(10), delta, 60);
+  check(readings, source, ngc :: string <'d', 'e', 'l', 't', 'a'> {}, ngc :: ge(0u), delta, rows); // Negative values convert to large unsigned ones.
+  check(readings, source, ngc :: string <'d', 'e', 'l', 't', 'a'> {}, ngc :: lt(-0.5), delta, 50);
+
+  // Constants that do not fit a narrow column.
+
+  check(readings, source, ngc :: string <'l', 'e', 'v', 'e', 'l'> {}, ngc :: lt(300), level, rows);
+  check(readings, source, ngc :: string <'l', 'e', 'v', 'e', 'l'> {}, ngc :: ge(0), level, 55);
+
+  // Integer and double constants on a float column.
+
+  check(readings, source, ngc :: string <'v', 'a', 'l', 'u', 'e'> {}, ngc :: ge(20), value, 20);
+  check(readings, source, ngc :: string <'v', 'a', 'l', 'u', 'e'> {}, ngc :: lt(2.6), value, 11);
+
+  // Selection and compaction: the first block is fully selected, the second
+  // partially, then both partially, then neither.
+
+  {
+    auto [counts, levels] = readings.where(ngc :: string <'v', 'a', 'l', 'u', 'e'> {}, ngc :: lt(20)).select(ngc :: string <'c', 'o', 'u', 'n', 't'> {}, ngc :: string <'l', 'e', 'v', 'e', 'l'> {});
+
+    bool copied = counts.size() == 80 && levels.size() == 80;
+
+    for(size_t i = 0; copied && i < 80; i++)
+      copied = counts[i] == source[i].count && levels[i] == source[i].level;
+
+    NGC_CHECK(copied);
+  }
+
+  {
+    ngc :: query <reading> odd = readings.where(ngc :: string <'d', 'e', 'l', 't', 'a'> {}, [](int32_t delta){ return delta % 2 != 0; });
+    auto [values] = odd.select(ngc :: string <'v', 'a', 'l', 'u', 'e'> {});
+
+    bool copied = odd.count() == 50 && values.size() == 50;
+
+    for(size_t i = 0; copied && i < 50; i++)
+      copied = values[i] == source[2 * i + 1].value;
+
+    NGC_CHECK(copied);
+
+    auto [none] = readings.where(ngc :: string <'l', 'e', 'v', 'e', 'l'> {}, ngc :: gt(127)).select(ngc :: string <'d', 'e', 'l', 't', 'a'> {});
+    NGC_CHECK(none.empty());
+  }
+
+  // Chained predicates: the first one leaves the second block empty, so that
+  // the next ones are only evaluated on the first block, then on none.
+
+  {
+    size_t calls = 0;
+
+    auto counted = [&calls](float value)
+    {
+      calls++;
+      return value >= 1;
+    };
+
+    ngc :: query <reading> chained = readings.where(ngc :: string <'d', 'e', 'l', 't', 'a'> {}, ngc :: lt(-40));
+
+    NGC_CHECK(chained.count() == 10);
+
+    chained.where(ngc :: string <'v', 'a', 'l', 'u', 'e'> {}, counted);
+
+    NGC_CHECK(calls == 64);
+    NGC_CHECK(chained.count() == 6);
+    NGC_CHECK(chained.bitmap()[0] == 0x3f0 && chained.bitmap()[1] == 0);
+
+    chained.where(ngc :: string <'l', 'e', 'v', 'e', 'l'> {}, ngc :: lt(-128)).where(ngc :: string <'v', 'a', 'l', 'u', 'e'> {}, counted);
+
+    NGC_CHECK(calls == 64);
+    NGC_CHECK(chained.count() == 0);
+
+    auto [ids] = chained.select(ngc :: string <'c', 'o', 'u', 'n', 't'> {});
+    NGC_CHECK(ids.empty());
+  }
+
+  return ngc_test :: result();
+}
@@ -0,0 +1,270 @@
+/**
+  Angular C core library - Rain
+
+  Released under GNU GENERAL PUBLIC LICENSE
+
+  See also:
+  - https://rain.vg
+  - https://github.com/rainvg/ngc
+
+  ------------------------------------------
+
+  \file sort_by.cpp
+
+  This file tests \c ngc \c :: \c sort_by, \c ngc \c :: \c sorted_indices and
+  \c ngc \c :: \c sorted_index: records must end up in the same order as with
+  \c std \c :: \c stable_sort, for signed, unsigned and floating point keys
+  (including negative values, and \c -0.0 and \c 0.0, that compare equal),
+  both below \c __ngc_sort__ \c :: \c threshold (comparison sort) and above
+  it (radix sort). \c __ngc_sort__ \c :: \c cycles, the fallback of
+  \c permute when no buffer can be allocated, must apply the same
+  permutation, and \c interpolate must agree with \c lower_bound on uniform
+  and skewed keys.
+
+  \author agent [agent@local]
+  \version 0.0.1
+  \date Oct 18, 2026
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../parsed.h"
+#include "../check.h"
+#include "ngc/sort.h"
+
+class entry
+{
+public:
+
+  typedef entry __ngc_introspected__;
+  template <size_t, bool> struct __ngc_member__;
+
+  inline void __ngc_destruct__()
+  {
+  }
+
+  int32_t s;
+  NGC_PARSED_MEMBER(entry, 0, int32_t, s, 's')
+
+  uint16_t u;
+  NGC_PARSED_MEMBER(entry, 1, uint16_t, u, 'u')
+
+  float f;
+  NGC_PARSED_MEMBER(entry, 2, float, f, 'f')
+
+  double d;
+  NGC_PARSED_MEMBER(entry, 3, double, d, 'd')
+
+  int64_t w;
+  NGC_PARSED_MEMBER(entry, 4, int64_t, w, 'w')
+
+  std :: string l;
+  NGC_PARSED_MEMBER(entry, 5, std :: string, l, 'l')
+
+  uint32_t seq;
+  NGC_PARSED_MEMBER(entry, 6, uint32_t, seq, 's', 'e', 'q')
+};
+
+namespace
+{
+  // Keys are drawn from small sets, so that most of them are repeated and
+  // the order of equal keys is checked.
+
+  std :: vector <entry> make_entries(size_t size, uint64_t seed)
+  {
+    static const float floats[] = {-0.0f, 0.0f, -1.5f, 1.5f, -1e30f, 1e30f, -std :: numeric_limits <float> :: infinity(), std :: numeric_limits <float> :: infinity(), std :: numeric_limits <float> :: denorm_min(), -std :: numeric_limits <float> :: denorm_min()};
+    static const double doubles[] = {-0.0, 0.0, -0.25, 0.25, -3e200, 3e200, -7, 7, std :: numeric_limits <double> :: lowest(), std :: numeric_limits <double> :: max()};
+    static const int64_t wides[] = {INT64_MIN, INT64_MAX, -1, 0, 1, -4294967296, 4294967296};
+
+    std :: mt19937_64 random(seed);
+    std :: vector <entry> entries(size);
+
+    for(size_t i = 0; i < size; i++)
+    {
+      entries[i].s = (int32_t) (random() % 101) - 50;
+      entries[i].u = random() % 8 == 0 ? 65535 : (uint16_t) (random() % 40);
+      entries[i].f = floats[random() % (sizeof(floats) / sizeof(float))];
+      entries[i].d = doubles[random() % (sizeof(doubles) / sizeof(double))];
+      entries[i].w = wides[random() % (sizeof(wides) / sizeof(int64_t))];
+      entries[i].l = std :: string(1, (char) ('a' + random() % 5));
+      entries[i].seq = (uint32_t) i;
+    }
+
+    return entries;
+  }
+
+  // Sorts entries by the member named name, with sort_by and sorted_indices,
+  // and checks both against std :: stable_sort on the same key.
+
+  template <typename name, typename ktype> bool sorts(const std :: vector <entry> & source, name, ktype entry :: * member)
+  {
+    std :: vector <entry> expected = source;
+
+    std :: stable_sort(expected.begin(), expected.end(), [&](const entry & left, const entry & right)
+    {
+      return left.*member < right.*member;
+    });
+
+    std :: vector <entry> sorted = source;
+    ngc :: sort_by(sorted, name {});
+
+    std :: vector <size_t> indices = ngc :: sorted_indices(source, name {});
+
+    if(indices.size() != source.size())
+      return false;
+
+    for(size_t i = 0; i < source.size(); i++)
+      if(sorted[i].seq != expected[i].seq || source[indices[i]].seq != expected[i].seq)
+        return false;
+
+    return true;
+  }
+
+  bool sorts(const std :: vector <entry> & source)
+  {
+    return sorts(source, ngc :: string <'s'> {}, &entry :: s) && sorts(source, ngc :: string <'u'> {}, &entry :: u) && sorts(source, ngc :: string <'f'> {}, &entry :: f) && sorts(source, ngc :: string <'d'> {}, &entry :: d) && sorts(source, ngc :: string <'w'> {}, &entry :: w) && sorts(source, ngc :: string <'l'> {}, &entry :: l);
+  }
+
+  // Checks interpolate against lower_bound on every key of an index, on
+  // values right below and above them, and beyond both ends.
+
+  template <typename ktype> bool interpolates(const ngc :: sorted_index <ktype> & index)
+  {
+    std :: vector <ktype> probes;
+
+    for(size_t rank = 0; rank < index.size(); rank++)
+    {
+      probes.push_back(index.key(rank));
+      probes.push_back(index.key(rank) - 1);
+      probes.push_back(index.key(rank) + 1);
+    }
+
+    probes.push_back(std :: numeric_limits <ktype> :: lowest());
+    probes.push_back(std :: numeric_limits <ktype> :: max());
+
+    for(const ktype & probe : probes)
+      if(index.interpolate(probe) != index.lower_bound(probe))
+        return false;
+
+    return true;
+  }
+};
+
+int main()
+{
+  // Comparison sort, at and around the threshold, and radix sort
+
+  const size_t sizes[] = {0, 1, 2, 100, __ngc_sort__ :: threshold - 1, __ngc_sort__ :: threshold, __ngc_sort__ :: threshold + 1, 5000};
+
+  for(size_t size : sizes)
+    NGC_CHECK(sorts(make_entries(size, size)));
+
+  // Negative and positive zeros compare equal, and keep their order
+
+  for(size_t size : {size_t(16), size_t(1024)})
+  {
+    std :: vector <entry> zeros = make_entries(size, 3);
+
+    for(size_t i = 0; i < size; i++)
+    {
+      zeros[i].d = (i % 3 == 0) ? -0.0 : (i % 3 == 1 ? 0.0 : -1.0);
+      zeros[i].f = (float) zeros[i].d;
+    }
+
+    NGC_CHECK(sorts(zeros));
+
+    ngc :: sort_by(zeros, ngc :: string <'d'> {});
+
+    bool ordered = true;
+
+    for(size_t i = 0; i < size; i++)
+      if(i < size / 3 ? zeros[i].d != -1.0 : (zeros[i].d != 0 || std :: signbit(zeros[i].d) != (zeros[i].seq % 3 == 0) || (i > size / 3 && zeros[i].seq < zeros[i - 1].seq)))
+        ordered = false;
+
+    NGC_CHECK(ordered);
+  }
+
+  // Permutation without a buffer
+
+  {
+    std :: vector <entry> source = make_entries(1000, 5);
+    std :: vector <uint32_t> order(source.size());
+
+    std :: iota(order.begin(), order.end(), 0);
+    std :: shuffle(order.begin(), order.end(), std :: mt19937_64(11));
+
+    std :: vector <uint32_t> clobbered = order;
+    std :: vector <entry> permuted = source;
+
+    __ngc_sort__ :: cycles(permuted, clobbered);
+
+    bool applied = true;
+
+    for(size_t i = 0; i < source.size(); i++)
+      if(permuted[i].seq != source[order[i]].seq || permuted[i].l != source[order[i]].l)
+        applied = false;
+
+    NGC_CHECK(applied);
+
+    // A single cycle through all the records, and the identity.
+
+    for(size_t i = 0; i < order.size(); i++)
+      order[i] = (uint32_t) ((i + 1) % order.size());
+
+    clobbered = order;
+    permuted = source;
+
+    __ngc_sort__ :: cycles(permuted, clobbered);
+
+    applied = true;
+
+    for(size_t i = 0; i < source.size(); i++)
+      if(permuted[i].seq != source[order[i]].seq)
+        applied = false;
+
+    std :: iota(clobbered.begin(), clobbered.end(), 0);
+    __ngc_sort__ :: cycles(permuted, clobbered);
+
+    for(size_t i = 0; i < source.size(); i++)
+      if(permuted[i].seq != source[order[i]].seq)
+        applied = false;
+
+    NGC_CHECK(applied);
+  }
+
+  // Interpolation search
+
+  {
+    std :: mt19937_64 random(13);
+    std :: vector <entry> uniform = make_entries(10000, 17);
+    std :: vector <entry> skewed = make_entries(10000, 19);
+
+    for(size_t i = 0; i < uniform.size(); i++)
+    {
+      uniform[i].d = std :: uniform_real_distribution <double> (-1e6, 1e6)(random);
+      uniform[i].w = (int64_t) (random() % 2000000) - 1000000;
+
+      skewed[i].d = std :: exp(std :: uniform_real_distribution <double> (0, 40)(random));
+      skewed[i].w = (int64_t) std :: pow(random() % 1000, 5) * (i % 2 ? 1 : -1);
+    }
+
+    NGC_CHECK(interpolates(ngc :: index_by(uniform, ngc :: string <'d'> {})));
+    NGC_CHECK(interpolates(ngc :: index_by(uniform, ngc :: string <'w'> {})));
+    NGC_CHECK(interpolates(ngc :: index_by(skewed, ngc :: string <'d'> {})));
+    NGC_CHECK(interpolates(ngc :: index_by(skewed, ngc :: string <'w'> {})));
+
+    // Repeated keys: interpolate must return the first of them.
+
+    NGC_CHECK(interpolates(ngc :: index_by(make_entries(10000, 23), ngc :: string <'s'> {})));
+    NGC_CHECK(interpolates(ngc :: index_by(make_entries(10, 29), ngc :: string <'s'> {})));
+  }
+
+  return ngc_test :: result();
+}